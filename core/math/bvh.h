@@ -65,12 +65,23 @@ public:
 	typedef void *(*PairCallback)(void *, uint32_t, T *, int, uint32_t, T *, int);
 	typedef void (*UnpairCallback)(void *, uint32_t, T *, int, uint32_t, T *, int, void *);
 	typedef void *(*CheckPairCallback)(void *, uint32_t, T *, int, uint32_t, T *, int, void *);
+	// Calls the function with the userdata and every index below the count, possibly on several
+	// threads, and returns once all the calls are done.
+	typedef void (*ParallelForCallback)(void (*)(void *, uint32_t), void *, uint32_t);
 
 	// allow locally toggling thread safety if the template has been compiled with BVH_THREAD_SAFE
 	void params_set_thread_safe(bool p_enable) {
 		_thread_safe = p_enable;
 	}
 
+	// When there are many changed items, collide them against the tree through the given
+	// parallel for, or on the calling thread if it's null.
+	// The pair and unpair callbacks are still sent from the calling thread, in the same order
+	// regardless of how the work was split.
+	void params_set_parallel_pairing(ParallelForCallback p_parallel_for) {
+		_parallel_for = p_parallel_for;
+	}
+
 	// these 2 are crucial for fine tuning, and can be applied manually
 	// see the variable declarations for more info.
 	void params_set_node_expansion(real_t p_value) {
@@ -381,6 +392,45 @@ public:
 		return params.result_count_overall;
 	}
 
+	// Versions of cull_aabb() and cull_segment() that don't lock, and collect their
+	// intermediate hits in r_hits instead of the tree's own buffer. Several threads can
+	// call these at once, as long as the BVH isn't modified while they run.
+	int cull_aabb_concurrent(const BOUNDS &p_aabb, T **p_result_array, int p_result_max, LocalVector<uint32_t, uint32_t, true> &r_hits, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.abb.from(p_aabb);
+		params.tester = p_tester;
+		params.hits = &r_hits;
+
+		tree.cull_aabb(params);
+
+		return params.result_count_overall;
+	}
+
+	int cull_segment_concurrent(const POINT &p_from, const POINT &p_to, T **p_result_array, int p_result_max, LocalVector<uint32_t, uint32_t, true> &r_hits, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = p_result_max;
+		params.result_array = p_result_array;
+		params.subindex_array = p_subindex_array;
+		params.tester = p_tester;
+		params.tree_collision_mask = p_tree_collision_mask;
+		params.hits = &r_hits;
+
+		params.segment.from = p_from;
+		params.segment.to = p_to;
+
+		tree.cull_segment(params);
+
+		return params.result_count_overall;
+	}
+
 	int cull_point(const POINT &p_point, T **p_result_array, int p_result_max, const T *p_tester, uint32_t p_tree_collision_mask = 0xFFFFFFFF, int *p_subindex_array = nullptr) {
 		BVH_LOCKED_FUNCTION
 		typename BVHTREE_CLASS::CullParams params;
@@ -435,6 +485,12 @@ private:
 			return;
 		}
 
+		if (_parallel_for && changed_items.size() >= PARALLEL_PAIRING_MIN_ITEMS) {
+			_check_for_collisions_parallel(p_full_check);
+			_reset();
+			return;
+		}
+
 		BOUNDS bb;
 
 		typename BVHTREE_CLASS::CullParams params;
@@ -480,6 +536,89 @@ private:
 		_reset();
 	}
 
+	// Finds the pairing changes for one chunk of changed items, without making them.
+	// Only reads the tree, so the chunks can run at the same time.
+	void _find_pairing_changes(uint32_t p_chunk, bool p_full_check) {
+		PairingChunk &chunk = _pairing_chunks[p_chunk];
+		chunk.changes.clear();
+
+		const uint32_t from = p_chunk * PARALLEL_PAIRING_CHUNK_SIZE;
+		const uint32_t to = MIN(from + PARALLEL_PAIRING_CHUNK_SIZE, changed_items.size());
+
+		typename BVHTREE_CLASS::CullParams params;
+
+		params.result_count_overall = 0;
+		params.result_max = INT_MAX;
+		params.result_array = nullptr;
+		params.subindex_array = nullptr;
+		params.hits = &chunk.hits;
+
+		for (uint32_t i = from; i < to; i++) {
+			const BVHHandle h = changed_items[i];
+			const typename BVHTREE_CLASS::ItemPairs &pairs = tree._pairs[h.id()];
+
+			BVHABB_CLASS abb;
+			abb.from(pairs.expanded_aabb);
+
+			tree.item_fill_cullparams(h, params);
+
+			// Leavers first, then enterers, like the serial version.
+			for (unsigned int n = 0; n < pairs.extended_pairs.size(); n++) {
+				BVHHandle h_to = pairs.extended_pairs[n].handle;
+				if (_should_unpair(abb, h, h_to, p_full_check)) {
+					chunk.changes.push_back({ h, h_to, true });
+				}
+			}
+
+			params.abb = abb;
+
+			params.result_count_overall = 0;
+			tree.cull_aabb(params, false);
+
+			for (const uint32_t ref_id : chunk.hits) {
+				if (ref_id == h.id()) {
+					continue;
+				}
+
+				BVHHandle h_collidee;
+				h_collidee.set_id(ref_id);
+
+				if (_can_pair(h, h_collidee)) {
+					chunk.changes.push_back({ h, h_collidee, false });
+				}
+			}
+		}
+	}
+
+	static void _find_pairing_changes_task(void *p_userdata, uint32_t p_chunk) {
+		PairingTask *task = (PairingTask *)p_userdata;
+		task->bvh->_find_pairing_changes(p_chunk, task->full_check);
+	}
+
+	void _check_for_collisions_parallel(bool p_full_check) {
+		const uint32_t chunk_count = (changed_items.size() + PARALLEL_PAIRING_CHUNK_SIZE - 1) / PARALLEL_PAIRING_CHUNK_SIZE;
+		if (_pairing_chunks.size() < chunk_count) {
+			_pairing_chunks.resize(chunk_count);
+		}
+
+		PairingTask task = { this, p_full_check };
+		_parallel_for(&BVH_Manager::_find_pairing_changes_task, &task, chunk_count);
+
+		// Apply the changes in changed item order. Both items of a pair can have found the
+		// same change, and earlier changes can make later ones redundant, so check again.
+		for (uint32_t i = 0; i < chunk_count; i++) {
+			for (const PairingChange &change : _pairing_chunks[i].changes) {
+				if (change.unpair) {
+					if (tree._pairs[change.from.id()].contains_pair_to(change.to)) {
+						_unpair(change.from, change.to);
+					}
+				} else {
+					_collide(change.from, change.to);
+				}
+			}
+		}
+	}
+
 public:
 	void item_get_AABB(BVHHandle p_handle, BOUNDS &r_aabb) {
 		DEV_ASSERT(!p_handle.is_invalid());
@@ -542,6 +681,15 @@ private:
 
 	// returns true if unpair
 	bool _find_leavers_process_pair(typename BVHTREE_CLASS::ItemPairs &p_pairs_from, const BVHABB_CLASS &p_abb_from, BVHHandle p_from, BVHHandle p_to, bool p_full_check) {
+		if (!_should_unpair(p_abb_from, p_from, p_to, p_full_check)) {
+			return false;
+		}
+
+		_unpair(p_from, p_to);
+		return true;
+	}
+
+	bool _should_unpair(const BVHABB_CLASS &p_abb_from, BVHHandle p_from, BVHHandle p_to, bool p_full_check) {
 		BVHABB_CLASS abb_to;
 		tree.item_get_ABB(p_to, abb_to);
 
@@ -568,7 +716,6 @@ private:
 			}
 		}
 
-		_unpair(p_from, p_to);
 		return true;
 	}
 
@@ -597,34 +744,16 @@ private:
 		// only have to do this oneway, lower ID then higher ID
 		tree._handle_sort(p_ha, p_hb);
 
-		const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(p_ha);
-		const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(p_hb);
-
-		// user collision callback
-		if (!USER_PAIR_TEST_FUNCTION::user_pair_check(exa.userdata, exb.userdata)) {
+		if (!_can_pair(p_ha, p_hb)) {
 			return;
 		}
 
-		// if the userdata is the same, no collisions should occur
-		if ((exa.userdata == exb.userdata) && exa.userdata) {
-			return;
-		}
+		const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(p_ha);
+		const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(p_hb);
 
 		typename BVHTREE_CLASS::ItemPairs &p_from = tree._pairs[p_ha.id()];
 		typename BVHTREE_CLASS::ItemPairs &p_to = tree._pairs[p_hb.id()];
 
-		// does this pair exist already?
-		// or only check the one with lower number of pairs for greater speed
-		if (p_from.num_pairs <= p_to.num_pairs) {
-			if (p_from.contains_pair_to(p_hb)) {
-				return;
-			}
-		} else {
-			if (p_to.contains_pair_to(p_ha)) {
-				return;
-			}
-		}
-
 		// callback
 		void *callback_userdata = nullptr;
 
@@ -641,6 +770,32 @@ private:
 		p_to.add_pair_to(p_ha, callback_userdata);
 	}
 
+	// true if the items are allowed to pair and aren't paired yet
+	bool _can_pair(BVHHandle p_ha, BVHHandle p_hb) const {
+		const typename BVHTREE_CLASS::ItemExtra &exa = _get_extra(p_ha);
+		const typename BVHTREE_CLASS::ItemExtra &exb = _get_extra(p_hb);
+
+		// user collision callback
+		if (!USER_PAIR_TEST_FUNCTION::user_pair_check(exa.userdata, exb.userdata)) {
+			return false;
+		}
+
+		// if the userdata is the same, no collisions should occur
+		if ((exa.userdata == exb.userdata) && exa.userdata) {
+			return false;
+		}
+
+		const typename BVHTREE_CLASS::ItemPairs &p_from = tree._pairs[p_ha.id()];
+		const typename BVHTREE_CLASS::ItemPairs &p_to = tree._pairs[p_hb.id()];
+
+		// does this pair exist already?
+		// or only check the one with lower number of pairs for greater speed
+		if (p_from.num_pairs <= p_to.num_pairs) {
+			return !p_from.contains_pair_to(p_hb);
+		}
+		return !p_to.contains_pair_to(p_ha);
+	}
+
 	// if we remove an item, we need to immediately remove the pairs, to prevent reading the pair after deletion
 	void _remove_pairs_containing(BVHHandle p_handle) {
 		typename BVHTREE_CLASS::ItemPairs &p_from = tree._pairs[p_handle.id()];
@@ -773,6 +928,32 @@ private:
 	LocalVector<BVHHandle, uint32_t, true> changed_items;
 	uint32_t _tick = 1; // Start from 1 so items with 0 indicate never updated.
 
+	// parallel pairing, see params_set_parallel_pairing()
+	enum {
+		PARALLEL_PAIRING_MIN_ITEMS = 256,
+		PARALLEL_PAIRING_CHUNK_SIZE = 64,
+	};
+
+	struct PairingTask {
+		BVH_Manager *bvh;
+		bool full_check;
+	};
+
+	struct PairingChange {
+		BVHHandle from;
+		BVHHandle to;
+		bool unpair;
+	};
+
+	// per chunk of changed items, reused between ticks
+	struct PairingChunk {
+		LocalVector<uint32_t, uint32_t, true> hits;
+		LocalVector<PairingChange> changes;
+	};
+
+	LocalVector<PairingChunk> _pairing_chunks;
+	ParallelForCallback _parallel_for = nullptr;
+
 	class BVHLockedFunction {
 	public:
 		BVHLockedFunction(Mutex *p_mutex, bool p_thread_safe) {
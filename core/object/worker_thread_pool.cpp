@@ -44,6 +44,53 @@ void WorkerThreadPool::Task::free_template_userdata() {
 	memdelete(btu);
 }
 
+bool WorkerThreadPool::TaskDeque::push(Task *p_task) {
+	int64_t b = bottom.load(std::memory_order_relaxed);
+	int64_t t = top.load(std::memory_order_acquire);
+	if (b - t >= CAPACITY) {
+		return false;
+	}
+	buffer[b & (CAPACITY - 1)].store(p_task, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	bottom.store(b + 1, std::memory_order_relaxed);
+	return true;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::TaskDeque::pop() {
+	int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+	bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t t = top.load(std::memory_order_relaxed);
+
+	Task *task = nullptr;
+	if (t <= b) {
+		task = buffer[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+		if (t == b) {
+			// Last element; race against thieves for it.
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+				task = nullptr;
+			}
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+	} else {
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return task;
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::TaskDeque::steal() {
+	int64_t t = top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t b = bottom.load(std::memory_order_acquire);
+	if (t < b) {
+		Task *task = buffer[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+		if (top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+			return task;
+		}
+	}
+	return nullptr; // Empty, or another thread won the race.
+}
+
 WorkerThreadPool *WorkerThreadPool::singleton = nullptr;
 
 #ifdef THREADS_ENABLED
@@ -51,6 +98,10 @@ thread_local WorkerThreadPool::UnlockableLocks WorkerThreadPool::unlockable_lock
 #endif
 
 void WorkerThreadPool::_process_task(Task *p_task) {
+	// In work-stealing mode, high-priority group and task graph tasks don't need the task mutex
+	// at all, since there's no task ID anybody could await or notify through.
+	const bool lockless = work_stealing.is_set() && (p_task->group || p_task->graph_run) && !p_task->low_priority;
+
 #ifdef THREADS_ENABLED
 	int pool_thread_index = thread_ids[Thread::get_caller_id()];
 	ThreadData &curr_thread = threads[pool_thread_index];
@@ -70,14 +121,19 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		// about to be run uses scripting, guarantees are held.
 		ScriptServer::thread_enter();
 
-		task_mutex.lock();
-		p_task->pool_thread_index = pool_thread_index;
-		prev_task = curr_thread.current_task;
-		curr_thread.current_task = p_task;
-		if (p_task->pending_notify_yield_over) {
-			curr_thread.yield_is_over = true;
+		if (lockless) {
+			prev_task = curr_thread.current_task;
+			curr_thread.current_task = p_task;
+		} else {
+			task_mutex.lock();
+			p_task->pool_thread_index = pool_thread_index;
+			prev_task = curr_thread.current_task;
+			curr_thread.current_task = p_task;
+			if (p_task->pending_notify_yield_over) {
+				curr_thread.yield_is_over = true;
+			}
+			task_mutex.unlock();
 		}
-		task_mutex.unlock();
 	}
 #endif
 
@@ -118,20 +174,34 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 		if (do_post) {
 			p_task->group->done_semaphore.post();
 			p_task->group->completed.set_to(true);
+
+			if (p_task->group->graph_run) {
+				_task_graph_node_completed(p_task->group->graph_run, p_task->group->graph_node);
+				// Nobody will wait for this group, so finish on behalf of the waiter.
+				p_task->group->finished.increment();
+			}
 		}
 		uint32_t max_users = p_task->group->tasks_used + 1; // Add 1 because the thread waiting for it is also user. Read before to avoid another thread freeing task after increment.
 		uint32_t finished_users = p_task->group->finished.increment();
 
 		if (finished_users == max_users) {
 			// Get rid of the group, because nobody else is using it.
-			MutexLock task_lock(task_mutex);
 			group_allocator.free(p_task->group);
 		}
 
-		// For groups, tasks get rid of themselves.
-
+#ifdef THREADS_ENABLED
+		// _notify_threads() may be looking at this task through current_task, so the thread must
+		// stop pointing at it, and the task only be freed once no notifier can still hold it.
+		curr_thread.current_task = prev_task;
+#endif
 		task_mutex.lock();
+
+		// For groups, tasks get rid of themselves.
 		task_allocator.free(p_task);
+
+		if (lockless) {
+			task_mutex.unlock();
+		}
 	} else {
 		if (p_task->native_func) {
 			p_task->native_func(p_task->native_func_userdata);
@@ -142,18 +212,20 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			p_task->callable.call();
 		}
 
-		task_mutex.lock();
-		p_task->completed = true;
-		p_task->pool_thread_index = -1;
-		if (p_task->waiting_user) {
-			p_task->done_semaphore.post(p_task->waiting_user);
-		}
-		// Let awaiters know.
-		for (uint32_t i = 0; i < threads.size(); i++) {
-			if (threads[i].awaited_task == p_task) {
-				threads[i].cond_var.notify_one();
-				threads[i].signaled = true;
+		if (p_task->graph_run) {
+			// Task graph nodes have no ID, so they only have to release their successors.
+			_task_graph_node_completed(p_task->graph_run, p_task->graph_node);
+#ifdef THREADS_ENABLED
+			curr_thread.current_task = prev_task; // Same as for groups, above.
+#endif
+			task_mutex.lock();
+			task_allocator.free(p_task);
+			if (lockless) {
+				task_mutex.unlock();
 			}
+		} else {
+			task_mutex.lock();
+			_notify_task_completed(p_task);
 		}
 	}
 
@@ -170,7 +242,9 @@ void WorkerThreadPool::_process_task(Task *p_task) {
 			}
 		}
 
-		task_mutex.unlock();
+		if (!lockless) {
+			task_mutex.unlock();
+		}
 	}
 
 	set_current_thread_safe_for_nodes(safe_for_nodes_backup);
@@ -182,8 +256,9 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 	ThreadData *thread_data = (ThreadData *)p_user;
 
 	while (true) {
-		Task *task_to_process = nullptr;
-		{
+		// Own and stolen work comes first, since it doesn't need the task mutex.
+		Task *task_to_process = singleton->_pop_or_steal_task(thread_data);
+		if (!task_to_process) {
 			MutexLock lock(singleton->task_mutex);
 
 			bool exit = singleton->_handle_runlevel(thread_data, lock);
@@ -197,7 +272,7 @@ void WorkerThreadPool::_thread_function(void *p_user) {
 				task_to_process = singleton->task_queue.first()->self();
 				singleton->task_queue.remove(singleton->task_queue.first());
 			} else {
-				thread_data->cond_var.wait(lock);
+				singleton->_wait_for_work(thread_data, lock);
 			}
 		}
 
@@ -248,6 +323,107 @@ void WorkerThreadPool::_post_tasks(Task **p_tasks, uint32_t p_count, bool p_high
 	_notify_threads(caller_pool_thread, to_process, to_promote);
 }
 
+// Returns how many tasks have been pushed. The rest must go through the global queue.
+uint32_t WorkerThreadPool::_post_tasks_to_deque(ThreadData *p_thread_data, Task **p_tasks, uint32_t p_count) {
+	if (unlikely(!deque_posting_allowed.is_set())) {
+		// Past RUNLEVEL_NORMAL, posting must go through _post_tasks(), which waits out the language exit.
+		return 0;
+	}
+
+	uint32_t pushed = 0;
+	for (; pushed < p_count; pushed++) {
+		p_tasks[pushed]->low_priority = false;
+		if (!p_thread_data->deque.push(p_tasks[pushed])) {
+			break;
+		}
+	}
+
+	if (pushed) {
+		// Pairs with the fence in _wait_for_work(): either a thread going to sleep sees the new
+		// tasks in the deque, or we see it's sleeping and wake it up.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (num_sleeping_threads.get()) {
+			MutexLock lock(task_mutex);
+			_notify_threads(p_thread_data, pushed, 0);
+		}
+	}
+
+	return pushed;
+}
+
+void WorkerThreadPool::_post_tasks_unlocked(Task **p_tasks, uint32_t p_count, bool p_high_priority) {
+	uint32_t pushed = 0;
+	if (p_high_priority && work_stealing.is_set()) {
+		int caller_thread_index = get_thread_index();
+		if (caller_thread_index != -1) {
+			pushed = _post_tasks_to_deque(&threads[caller_thread_index], p_tasks, p_count);
+		}
+	}
+
+	if (pushed < p_count) {
+		MutexLock<BinaryMutex> lock(task_mutex);
+		_post_tasks(p_tasks + pushed, p_count - pushed, p_high_priority, lock);
+	}
+}
+
+// Must be called with the task mutex locked.
+void WorkerThreadPool::_notify_task_completed(Task *p_task) {
+	p_task->completed = true;
+	p_task->pool_thread_index = -1;
+	if (p_task->waiting_user) {
+		p_task->done_semaphore.post(p_task->waiting_user);
+	}
+	// Let awaiters know.
+	for (uint32_t i = 0; i < threads.size(); i++) {
+		if (threads[i].awaited_task == p_task) {
+			threads[i].cond_var.notify_one();
+			threads[i].signaled = true;
+		}
+	}
+}
+
+WorkerThreadPool::Task *WorkerThreadPool::_pop_or_steal_task(ThreadData *p_thread_data) {
+	if (!p_thread_data->deque.is_empty()) {
+		Task *task = p_thread_data->deque.pop();
+		if (task) {
+			return task;
+		}
+	}
+
+	uint32_t thread_count = threads.size();
+	for (uint32_t i = 1; i < thread_count; i++) {
+		TaskDeque &victim = threads[(p_thread_data->index + i) % thread_count].deque;
+		if (!victim.is_empty()) {
+			Task *task = victim.steal();
+			if (task) {
+				return task;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool WorkerThreadPool::_has_deque_tasks() const {
+	for (const ThreadData &th : threads) {
+		if (!th.deque.is_empty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void WorkerThreadPool::_wait_for_work(ThreadData *p_thread_data, MutexLock<BinaryMutex> &p_lock) {
+	// Announce the intent to sleep before having a last look at the deques, since submitters
+	// pushing to them don't take the task mutex unless they see sleeping threads.
+	num_sleeping_threads.increment();
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!_has_deque_tasks()) {
+		p_thread_data->cond_var.wait(p_lock);
+	}
+	num_sleeping_threads.decrement();
+}
+
 void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count) {
 	uint32_t to_process = p_process_count;
 	uint32_t to_promote = p_promote_count;
@@ -274,7 +450,7 @@ void WorkerThreadPool::_notify_threads(const ThreadData *p_current_thread_data,
 		}
 		if (th.current_task) {
 			// Good thread for promoting low-prio?
-			if (to_promote && th.awaited_task && th.current_task->low_priority) {
+			if (to_promote && th.awaited_task && th.current_task.load()->low_priority) {
 				if (likely(&th != p_current_thread_data)) {
 					th.cond_var.notify_one();
 				}
@@ -329,20 +505,33 @@ WorkerThreadPool::TaskID WorkerThreadPool::add_native_task(void (*p_func)(void *
 }
 
 WorkerThreadPool::TaskID WorkerThreadPool::_add_task(const Callable &p_callable, void (*p_func)(void *), void *p_userdata, BaseTemplateUserdata *p_template_userdata, bool p_high_priority, const String &p_description) {
-	MutexLock<BinaryMutex> lock(task_mutex);
-
 	// Get a free task
 	Task *task = task_allocator.alloc();
-	TaskID id = last_task++;
+	TaskID id = last_task.postincrement();
 	task->self = id;
 	task->callable = p_callable;
 	task->native_func = p_func;
 	task->native_func_userdata = p_userdata;
 	task->description = p_description;
 	task->template_userdata = p_template_userdata;
-	tasks.insert(id, task);
 
-	_post_tasks(&task, 1, p_high_priority, lock);
+	int caller_thread_index = p_high_priority && work_stealing.is_set() ? get_thread_index() : -1;
+
+	{
+		MutexLock<BinaryMutex> lock(task_mutex);
+		tasks.insert(id, task);
+		if (caller_thread_index == -1) {
+			_post_tasks(&task, 1, p_high_priority, lock);
+			return id;
+		}
+	}
+
+	// The task still has to be registered so it can be awaited, but queuing it
+	// and waking threads up is left to the deque of the submitting pool thread.
+	if (!_post_tasks_to_deque(&threads[caller_thread_index], &task, 1)) {
+		MutexLock<BinaryMutex> lock(task_mutex);
+		_post_tasks(&task, 1, p_high_priority, lock);
+	}
 
 	return id;
 }
@@ -380,7 +569,7 @@ Error WorkerThreadPool::wait_for_task_completion(TaskID p_task_id) {
 	}
 
 	ThreadData *caller_pool_thread = thread_ids.has(Thread::get_caller_id()) ? &threads[thread_ids[Thread::get_caller_id()]] : nullptr;
-	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task->self) {
+	if (caller_pool_thread && p_task_id <= caller_pool_thread->current_task.load()->self) {
 		// Deadlock prevention:
 		// When a pool thread wants to wait for an older task, the following situations can happen:
 		// 1. Awaited task is deep in the stack of the awaiter.
@@ -479,8 +668,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				if (was_signaled) {
 					// This thread was awaken for some additional reason, but it's about to exit.
 					// Let's find out what may be pending and forward the requests.
-					uint32_t to_process = task_queue.first() ? 1 : 0;
-					uint32_t to_promote = p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first() ? 1 : 0;
+					uint32_t to_process = task_queue.first() || _has_deque_tasks() ? 1 : 0;
+					uint32_t to_promote = p_caller_pool_thread->current_task.load()->low_priority && low_priority_task_queue.first() ? 1 : 0;
 					if (to_process || to_promote) {
 						// This thread must be left alone since it won't loop again.
 						p_caller_pool_thread->signaled = true;
@@ -491,7 +680,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				break;
 			}
 
-			if (p_caller_pool_thread->current_task->low_priority && low_priority_task_queue.first()) {
+			if (p_caller_pool_thread->current_task.load()->low_priority && low_priority_task_queue.first()) {
 				if (_try_promote_low_priority_task()) {
 					_notify_threads(p_caller_pool_thread, 1, 0);
 				}
@@ -500,6 +689,8 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 			if (singleton->task_queue.first()) {
 				task_to_process = task_queue.first()->self();
 				task_queue.remove(task_queue.first());
+			} else {
+				task_to_process = _pop_or_steal_task(p_caller_pool_thread);
 			}
 
 			if (!task_to_process) {
@@ -508,7 +699,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 				_unlock_unlockable_mutexes();
 				relock_unlockables = true;
 
-				p_caller_pool_thread->cond_var.wait(lock);
+				_wait_for_work(p_caller_pool_thread, lock);
 
 				p_caller_pool_thread->awaited_task = nullptr;
 			}
@@ -527,6 +718,7 @@ void WorkerThreadPool::_wait_collaboratively(ThreadData *p_caller_pool_thread, T
 void WorkerThreadPool::_switch_runlevel(Runlevel p_runlevel) {
 	DEV_ASSERT(p_runlevel > runlevel);
 	runlevel = p_runlevel;
+	deque_posting_allowed.clear();
 	memset(&runlevel_data, 0, sizeof(runlevel_data));
 	for (uint32_t i = 0; i < threads.size(); i++) {
 		threads[i].cond_var.notify_one();
@@ -543,7 +735,7 @@ bool WorkerThreadPool::_handle_runlevel(ThreadData *p_thread_data, MutexLock<Bin
 		} break;
 		case RUNLEVEL_PRE_EXIT_LANGUAGES: {
 			if (!p_thread_data->pre_exited_languages) {
-				if (!task_queue.first() && !low_priority_task_queue.first()) {
+				if (!task_queue.first() && !low_priority_task_queue.first() && !_has_deque_tasks()) {
 					p_thread_data->pre_exited_languages = true;
 					runlevel_data.pre_exit_languages.num_idle_threads++;
 					control_cond_var.notify_all();
@@ -612,10 +804,8 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		p_tasks = MAX(1u, threads.size());
 	}
 
-	MutexLock<BinaryMutex> lock(task_mutex);
-
 	Group *group = group_allocator.alloc();
-	GroupID id = last_task++;
+	GroupID id = last_task.postincrement();
 	group->max = p_elements;
 	group->self = id;
 
@@ -646,9 +836,12 @@ WorkerThreadPool::GroupID WorkerThreadPool::_add_group_task(const Callable &p_ca
 		}
 	}
 
-	groups[id] = group;
+	{
+		MutexLock group_lock(group_mutex);
+		groups[id] = group;
+	}
 
-	_post_tasks(tasks_posted, p_tasks, p_high_priority, lock);
+	_post_tasks_unlocked(tasks_posted, p_tasks, p_high_priority);
 
 	return id;
 }
@@ -662,7 +855,7 @@ WorkerThreadPool::GroupID WorkerThreadPool::add_group_task(const Callable &p_act
 }
 
 uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) const {
-	MutexLock task_lock(task_mutex);
+	MutexLock group_lock(group_mutex);
 	const Group *const *groupp = groups.getptr(p_group);
 	if (!groupp) {
 		ERR_FAIL_V_MSG(0, "Invalid Group ID");
@@ -670,7 +863,7 @@ uint32_t WorkerThreadPool::get_group_processed_element_count(GroupID p_group) co
 	return (*groupp)->completed_index.get();
 }
 bool WorkerThreadPool::is_group_task_completed(GroupID p_group) const {
-	MutexLock task_lock(task_mutex);
+	MutexLock group_lock(group_mutex);
 	const Group *const *groupp = groups.getptr(p_group);
 	if (!groupp) {
 		ERR_FAIL_V_MSG(false, "Invalid Group ID");
@@ -680,9 +873,9 @@ bool WorkerThreadPool::is_group_task_completed(GroupID p_group) const {
 
 void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 #ifdef THREADS_ENABLED
-	task_mutex.lock();
+	group_mutex.lock();
 	Group **groupp = groups.getptr(p_group);
-	task_mutex.unlock();
+	group_mutex.unlock();
 	if (!groupp) {
 		ERR_FAIL_MSG("Invalid Group ID.");
 	}
@@ -690,6 +883,20 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 	{
 		Group *group = *groupp;
 
+		int caller_thread_index = get_thread_index();
+		if (caller_thread_index != -1) {
+			// Help before blocking. If the group was posted from this thread in work-stealing mode,
+			// its tasks are at the bottom of this thread's deque, so it will likely complete here.
+			ThreadData &caller_thread = threads[caller_thread_index];
+			while (!group->completed.is_set()) {
+				Task *task = caller_thread.deque.pop();
+				if (!task) {
+					break;
+				}
+				_process_task(task);
+			}
+		}
+
 		_unlock_unlockable_mutexes();
 		group->done_semaphore.wait();
 		_lock_unlockable_mutexes();
@@ -699,16 +906,167 @@ void WorkerThreadPool::wait_for_group_task_completion(GroupID p_group) {
 
 		if (finished_users == max_users) {
 			// All tasks using this group are gone (finished before the group), so clear the group too.
-			MutexLock task_lock(task_mutex);
 			group_allocator.free(group);
 		}
 	}
 
-	MutexLock task_lock(task_mutex); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
+	MutexLock group_lock(group_mutex); // This mutex is needed when Physics 2D and/or 3D is selected to run on a separate thread.
 	groups.erase(p_group);
 #endif
 }
 
+static void _task_graph_empty_node_func(void *p_userdata) {
+}
+
+WorkerThreadPool::TaskID WorkerThreadPool::submit_task_graph(TaskGraph &p_graph, bool p_high_priority, const String &p_description) {
+	// The sink is what callers wait for. It's completed directly once all nodes are done.
+	Task *sink = task_allocator.alloc();
+	TaskID id = last_task.postincrement();
+	sink->self = id;
+	sink->description = p_description;
+	{
+		MutexLock<BinaryMutex> lock(task_mutex);
+		tasks.insert(id, sink);
+	}
+
+	if (p_graph.nodes.is_empty()) {
+		MutexLock<BinaryMutex> lock(task_mutex);
+		_notify_task_completed(sink);
+		return id;
+	}
+
+	TaskGraphRun *run = memnew(TaskGraphRun);
+	run->sink = sink;
+	run->high_priority = p_high_priority;
+	run->pending_nodes.set(p_graph.nodes.size());
+	run->nodes.resize(p_graph.nodes.size());
+
+	LocalVector<Task *> root_tasks;
+
+	for (uint32_t i = 0; i < p_graph.nodes.size(); i++) {
+		const TaskGraph::Node &src = p_graph.nodes[i];
+		TaskGraphRun::Node &node = run->nodes[i];
+		node.successors = src.successors;
+		node.pending_predecessors.set(src.predecessor_count);
+
+		if (src.elements == 0) {
+			// Nothing to run, but the node must still complete to release its successors.
+			if (src.template_userdata) {
+				memdelete(src.template_userdata);
+			}
+			Task *task = task_allocator.alloc();
+			task->native_func = _task_graph_empty_node_func;
+			task->description = p_description;
+			task->graph_run = run;
+			task->graph_node = i;
+			node.tasks.push_back(task);
+		} else if (src.elements < 0) {
+			Task *task = task_allocator.alloc();
+			task->native_func = src.native_func;
+			task->native_func_userdata = src.native_func_userdata;
+			task->template_userdata = src.template_userdata;
+			task->description = p_description;
+			task->graph_run = run;
+			task->graph_node = i;
+			node.tasks.push_back(task);
+		} else {
+			// Same setup as a regular group task, except it's not registered, so it can't be awaited.
+			Group *group = group_allocator.alloc();
+			group->max = src.elements;
+			group->graph_run = run;
+			group->graph_node = i;
+
+			int task_count = src.tasks < 0 ? MAX(1u, threads.size()) : MAX(1, src.tasks);
+			group->tasks_used = task_count;
+			for (int j = 0; j < task_count; j++) {
+				Task *task = task_allocator.alloc();
+				task->native_group_func = src.native_group_func;
+				task->native_func_userdata = src.native_func_userdata;
+				task->template_userdata = src.template_userdata;
+				task->description = p_description;
+				task->group = group;
+				node.tasks.push_back(task);
+			}
+		}
+
+		if (src.predecessor_count == 0) {
+			for (Task *task : node.tasks) {
+				root_tasks.push_back(task);
+			}
+		}
+	}
+
+	// Ownership of the template userdata has been transferred to the tasks.
+	for (TaskGraph::Node &src : p_graph.nodes) {
+		src.template_userdata = nullptr;
+	}
+	p_graph.clear();
+
+	// Nothing in the run can be touched from here on, as it may be completed and freed at any moment.
+	_post_tasks_unlocked(root_tasks.ptr(), root_tasks.size(), p_high_priority);
+
+	return id;
+}
+
+void WorkerThreadPool::_task_graph_node_completed(TaskGraphRun *p_run, uint32_t p_node) {
+	for (uint32_t successor : p_run->nodes[p_node].successors) {
+		TaskGraphRun::Node &node = p_run->nodes[successor];
+		if (node.pending_predecessors.decrement() == 0) {
+			_post_tasks_unlocked(node.tasks.ptr(), node.tasks.size(), p_run->high_priority);
+		}
+	}
+
+	// Successors are released first, so the run is no longer in use when the last node gets here.
+	if (p_run->pending_nodes.decrement() == 0) {
+		Task *sink = p_run->sink;
+		memdelete(p_run);
+
+		MutexLock<BinaryMutex> lock(task_mutex);
+		_notify_task_completed(sink);
+	}
+}
+
+uint32_t WorkerThreadPool::TaskGraph::_add_node(void (*p_func)(void *), void (*p_group_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks) {
+	Node node;
+	node.native_func = p_func;
+	node.native_group_func = p_group_func;
+	node.native_func_userdata = p_userdata;
+	node.template_userdata = p_template_userdata;
+	node.elements = p_elements;
+	node.tasks = p_tasks;
+	nodes.push_back(node);
+	return nodes.size() - 1;
+}
+
+uint32_t WorkerThreadPool::TaskGraph::add_native_task(void (*p_func)(void *), void *p_userdata) {
+	return _add_node(p_func, nullptr, p_userdata, nullptr, -1, -1);
+}
+
+uint32_t WorkerThreadPool::TaskGraph::add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks) {
+	ERR_FAIL_COND_V(p_elements < 0, UINT32_MAX);
+	return _add_node(nullptr, p_func, p_userdata, nullptr, p_elements, p_tasks);
+}
+
+void WorkerThreadPool::TaskGraph::add_dependency(uint32_t p_predecessor, uint32_t p_successor) {
+	ERR_FAIL_UNSIGNED_INDEX(p_successor, nodes.size());
+	ERR_FAIL_COND_MSG(p_predecessor >= p_successor, "A predecessor must be added to the graph before its successors.");
+	nodes[p_predecessor].successors.push_back(p_successor);
+	nodes[p_successor].predecessor_count++;
+}
+
+void WorkerThreadPool::TaskGraph::clear() {
+	for (Node &node : nodes) {
+		if (node.template_userdata) {
+			memdelete(node.template_userdata);
+		}
+	}
+	nodes.clear();
+}
+
+WorkerThreadPool::TaskGraph::~TaskGraph() {
+	clear();
+}
+
 int WorkerThreadPool::get_thread_index() {
 	Thread::ID tid = Thread::get_caller_id();
 	return singleton->thread_ids.has(tid) ? singleton->thread_ids[tid] : -1;
@@ -717,7 +1075,7 @@ int WorkerThreadPool::get_thread_index() {
 WorkerThreadPool::TaskID WorkerThreadPool::get_caller_task_id() {
 	int th_index = get_thread_index();
 	if (th_index != -1 && singleton->threads[th_index].current_task) {
-		return singleton->threads[th_index].current_task->self;
+		return singleton->threads[th_index].current_task.load()->self;
 	} else {
 		return INVALID_TASK_ID;
 	}
@@ -749,10 +1107,12 @@ void WorkerThreadPool::thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {
 }
 #endif
 
-void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio) {
+void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio, bool p_work_stealing) {
 	ERR_FAIL_COND(threads.size() > 0);
 
 	runlevel = RUNLEVEL_NORMAL;
+	deque_posting_allowed.set();
+	work_stealing.set_to(p_work_stealing);
 
 	if (p_thread_count < 0) {
 		p_thread_count = OS::get_singleton()->get_default_thread_pool_size();
@@ -760,7 +1120,7 @@ void WorkerThreadPool::init(int p_thread_count, float p_low_priority_task_ratio)
 
 	max_low_priority_threads = CLAMP(p_thread_count * p_low_priority_task_ratio, 1, p_thread_count - 1);
 
-	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority.", p_thread_count, max_low_priority_threads));
+	print_verbose(vformat("WorkerThreadPool: %d threads, %d max low-priority%s.", p_thread_count, max_low_priority_threads, p_work_stealing ? ", work-stealing" : ""));
 
 	threads.resize(p_thread_count);
 
@@ -816,8 +1176,11 @@ void WorkerThreadPool::finish() {
 		for (KeyValue<TaskID, Task *> &E : tasks) {
 			task_allocator.free(E.value);
 		}
+		tasks.clear();
 	}
 
+	// Leave the pool ready to be initialized again.
+	thread_ids.clear();
 	threads.clear();
 }
 
@@ -53,6 +53,7 @@ public:
 
 private:
 	struct Task;
+	struct TaskGraphRun;
 
 	struct BaseTemplateUserdata {
 		virtual void callback() {}
@@ -69,6 +70,8 @@ private:
 		SafeFlag completed;
 		SafeNumeric<uint32_t> finished;
 		uint32_t tasks_used = 0;
+		TaskGraphRun *graph_run = nullptr; // Non-null if this group is a node of a task graph.
+		uint32_t graph_node = 0;
 	};
 
 	struct Task {
@@ -88,6 +91,8 @@ private:
 		bool low_priority = false;
 		BaseTemplateUserdata *template_userdata = nullptr;
 		int pool_thread_index = -1;
+		TaskGraphRun *graph_run = nullptr; // Non-null if this task is a node of a task graph.
+		uint32_t graph_node = 0;
 
 		void free_template_userdata();
 		Task() :
@@ -96,16 +101,50 @@ private:
 				task_elem(this) {}
 	};
 
+	// A submitted task graph. Nodes get their tasks posted as soon as all their predecessors
+	// are done, and the sink task is completed (never run) once every node is done.
+	struct TaskGraphRun {
+		struct Node {
+			LocalVector<Task *> tasks;
+			LocalVector<uint32_t> successors;
+			SafeNumeric<uint32_t> pending_predecessors;
+		};
+
+		LocalVector<Node> nodes;
+		SafeNumeric<uint32_t> pending_nodes;
+		Task *sink = nullptr;
+		bool high_priority = false;
+	};
+
 	static const uint32_t TASKS_PAGE_SIZE = 1024;
 	static const uint32_t GROUPS_PAGE_SIZE = 256;
 
-	PagedAllocator<Task, false, TASKS_PAGE_SIZE> task_allocator;
-	PagedAllocator<Group, false, GROUPS_PAGE_SIZE> group_allocator;
+	// Thread-safe, so tasks can be created and released without holding the task mutex.
+	PagedAllocator<Task, true, TASKS_PAGE_SIZE> task_allocator;
+	PagedAllocator<Group, true, GROUPS_PAGE_SIZE> group_allocator;
 
 	SelfList<Task>::List low_priority_task_queue;
-	SelfList<Task>::List task_queue;
+	SelfList<Task>::List task_queue; // In work-stealing mode, only fed by non-pool threads (plus overflow).
 
 	BinaryMutex task_mutex;
+	BinaryMutex group_mutex; // Only guards the groups map.
+
+	// Bounded Chase-Lev deque. The owner thread pushes and pops at the bottom (LIFO), whereas
+	// other threads steal from the top (FIFO). Neither operation takes any lock.
+	struct TaskDeque {
+		static const int64_t CAPACITY = 256; // Must be a power of two.
+
+		std::atomic<int64_t> top = 0;
+		std::atomic<int64_t> bottom = 0;
+		std::atomic<Task *> buffer[CAPACITY];
+
+		bool push(Task *p_task); // Owner only. Returns false if full.
+		Task *pop(); // Owner only.
+		Task *steal();
+		_FORCE_INLINE_ bool is_empty() const {
+			return bottom.load(std::memory_order_acquire) <= top.load(std::memory_order_acquire);
+		}
+	};
 
 	struct ThreadData {
 		static Task *const YIELDING; // Too bad constexpr doesn't work here.
@@ -116,9 +155,10 @@ private:
 		bool yield_is_over : 1;
 		bool pre_exited_languages : 1;
 		bool exited_languages : 1;
-		Task *current_task = nullptr;
+		std::atomic<Task *> current_task = nullptr; // Atomic because lockless group tasks set it without the task mutex.
 		Task *awaited_task = nullptr; // Null if not awaiting the condition variable, or special value (YIELDING).
 		ConditionVariable cond_var;
+		TaskDeque deque;
 
 		ThreadData() :
 				signaled(false),
@@ -164,15 +204,27 @@ private:
 	uint32_t low_priority_threads_used = 0;
 	uint32_t notify_index = 0; // For rotating across threads, no help distributing load.
 
-	uint64_t last_task = 1;
+	SafeNumeric<uint64_t> last_task{ 1 };
+
+	SafeFlag work_stealing;
+	SafeFlag deque_posting_allowed; // Mirrors runlevel == RUNLEVEL_NORMAL for the lockless posting path.
+	SafeNumeric<uint32_t> num_sleeping_threads; // Threads about to wait on, or waiting on, their condition variable.
 
 	static void _thread_function(void *p_user);
 
 	void _process_task(Task *task);
 
 	void _post_tasks(Task **p_tasks, uint32_t p_count, bool p_high_priority, MutexLock<BinaryMutex> &p_lock);
+	uint32_t _post_tasks_to_deque(ThreadData *p_thread_data, Task **p_tasks, uint32_t p_count);
+	void _post_tasks_unlocked(Task **p_tasks, uint32_t p_count, bool p_high_priority);
+	void _notify_task_completed(Task *p_task);
+	void _task_graph_node_completed(TaskGraphRun *p_run, uint32_t p_node);
 	void _notify_threads(const ThreadData *p_current_thread_data, uint32_t p_process_count, uint32_t p_promote_count);
 
+	Task *_pop_or_steal_task(ThreadData *p_thread_data);
+	bool _has_deque_tasks() const;
+	void _wait_for_work(ThreadData *p_thread_data, MutexLock<BinaryMutex> &p_lock);
+
 	bool _try_promote_low_priority_task();
 
 	static WorkerThreadPool *singleton;
@@ -225,6 +277,60 @@ protected:
 	static void _bind_methods();
 
 public:
+	// Describes a set of tasks and group tasks with predecessor edges among them, to be submitted as a whole.
+	// Each node is posted as soon as all its predecessors are complete, so no thread blocks between stages.
+	class TaskGraph {
+		friend class WorkerThreadPool;
+
+		struct Node {
+			void (*native_func)(void *) = nullptr;
+			void (*native_group_func)(void *, uint32_t) = nullptr;
+			void *native_func_userdata = nullptr;
+			BaseTemplateUserdata *template_userdata = nullptr;
+			int elements = -1; // Negative for single tasks.
+			int tasks = -1;
+			uint32_t predecessor_count = 0;
+			LocalVector<uint32_t> successors;
+		};
+
+		LocalVector<Node> nodes;
+
+		uint32_t _add_node(void (*p_func)(void *), void (*p_group_func)(void *, uint32_t), void *p_userdata, BaseTemplateUserdata *p_template_userdata, int p_elements, int p_tasks);
+
+	public:
+		template <typename C, typename M, typename U>
+		uint32_t add_template_task(C *p_instance, M p_method, U p_userdata) {
+			typedef TaskUserData<C, M, U> TUD;
+			TUD *ud = memnew(TUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			return _add_node(nullptr, nullptr, nullptr, ud, -1, -1);
+		}
+		uint32_t add_native_task(void (*p_func)(void *), void *p_userdata);
+
+		template <typename C, typename M, typename U>
+		uint32_t add_template_group_task(C *p_instance, M p_method, U p_userdata, int p_elements, int p_tasks = -1) {
+			ERR_FAIL_COND_V(p_elements < 0, UINT32_MAX);
+			typedef GroupUserData<C, M, U> GroupUD;
+			GroupUD *ud = memnew(GroupUD);
+			ud->instance = p_instance;
+			ud->method = p_method;
+			ud->userdata = p_userdata;
+			return _add_node(nullptr, nullptr, nullptr, ud, p_elements, p_tasks);
+		}
+		uint32_t add_native_group_task(void (*p_func)(void *, uint32_t), void *p_userdata, int p_elements, int p_tasks = -1);
+
+		// Predecessors must have been added before their successors, which keeps the graph acyclic.
+		void add_dependency(uint32_t p_predecessor, uint32_t p_successor);
+
+		uint32_t get_node_count() const { return nodes.size(); }
+		bool is_empty() const { return nodes.is_empty(); }
+		void clear();
+
+		~TaskGraph();
+	};
+
 	template <typename C, typename M, typename U>
 	TaskID add_template_task(C *p_instance, M p_method, U p_userdata, bool p_high_priority = false, const String &p_description = String()) {
 		typedef TaskUserData<C, M, U> TUD;
@@ -258,6 +364,10 @@ public:
 	bool is_group_task_completed(GroupID p_group) const;
 	void wait_for_group_task_completion(GroupID p_group);
 
+	// Posts the graph and leaves it empty. The returned task completes once every node has completed
+	// and must be awaited like any other task. Nodes themselves can't be awaited individually.
+	TaskID submit_task_graph(TaskGraph &p_graph, bool p_high_priority = false, const String &p_description = String());
+
 	_FORCE_INLINE_ int get_thread_count() const {
 #ifdef THREADS_ENABLED
 		return threads.size();
@@ -282,7 +392,12 @@ public:
 	static void thread_exit_unlock_allowance_zone(uint32_t p_zone_id) {}
 #endif
 
-	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3);
+	// In work-stealing mode, high-priority tasks submitted from pool threads go to the submitter's
+	// own deque and idle threads steal from there, instead of everything going through the global queue.
+	void set_work_stealing_enabled(bool p_enabled) { work_stealing.set_to(p_enabled); }
+	bool is_work_stealing_enabled() const { return work_stealing.is_set(); }
+
+	void init(int p_thread_count = -1, float p_low_priority_task_ratio = 0.3, bool p_work_stealing = false);
 	void exit_languages_threads();
 	void finish();
 	WorkerThreadPool();
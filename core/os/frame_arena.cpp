@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+#include "core/os/thread.h"
+
+thread_local FrameArena FrameArena::thread_arena;
+
+SafeNumeric<uint64_t> FrameArena::usage;
+SafeNumeric<uint64_t> FrameArena::frame_peak_usage;
+SafeNumeric<uint64_t> FrameArena::last_frame_peak_usage;
+SafeNumeric<uint64_t> FrameArena::max_peak_usage;
+
+FrameArena::Scope::Scope() {
+	arena = FrameArena::get_thread_arena();
+	mark = arena->get_mark();
+	arena->scope_depth++;
+}
+
+FrameArena::Scope::~Scope() {
+	arena->scope_depth--;
+	arena->rewind(mark);
+}
+
+void FrameArena::_update_usage(size_t p_old_used) {
+	size_t used = _get_used();
+	if (used > p_old_used) {
+		uint64_t total = usage.add(used - p_old_used);
+		frame_peak_usage.exchange_if_greater(total);
+	} else if (used < p_old_used) {
+		usage.sub(p_old_used - used);
+	}
+}
+
+void FrameArena::_free_chunks() {
+	for (const Chunk &c : chunks) {
+		memfree(c.data);
+	}
+	chunks.clear();
+}
+
+void *FrameArena::alloc(size_t p_bytes, size_t p_alignment) {
+	DEV_ASSERT(p_alignment > 0 && (p_alignment & (p_alignment - 1)) == 0);
+	size_t old_used = _get_used();
+
+	while (chunk < chunks.size()) {
+		const Chunk &c = chunks[chunk];
+		uintptr_t base = (uintptr_t)c.data;
+		size_t start = (((base + offset) + p_alignment - 1) & ~(uintptr_t)(p_alignment - 1)) - base;
+		if (start + p_bytes <= c.size) {
+			offset = start + p_bytes;
+			_update_usage(old_used);
+			return c.data + start;
+		}
+		// Doesn't fit, the rest of this chunk is wasted until the arena rewinds.
+		chunk_base += c.size;
+		chunk++;
+		offset = 0;
+	}
+
+	Chunk c;
+	c.size = MAX(MIN_CHUNK_SIZE, chunks.is_empty() ? size_t(0) : chunks[chunks.size() - 1].size * 2);
+	c.size = MAX(c.size, nearest_power_of_2_templated(p_bytes + p_alignment));
+	c.data = (uint8_t *)memalloc(c.size);
+	CRASH_COND_MSG(!c.data, "Out of memory");
+	chunks.push_back(c);
+
+	uintptr_t base = (uintptr_t)c.data;
+	size_t start = ((base + p_alignment - 1) & ~(uintptr_t)(p_alignment - 1)) - base;
+	offset = start + p_bytes;
+	_update_usage(old_used);
+	return c.data + start;
+}
+
+bool FrameArena::extend(void *p_ptr, size_t p_old_bytes, size_t p_new_bytes) {
+	if (chunk >= chunks.size()) {
+		return false;
+	}
+	const Chunk &c = chunks[chunk];
+	uint8_t *ptr = (uint8_t *)p_ptr;
+	if (ptr + p_old_bytes != c.data + offset) {
+		return false; // Not the last allocation.
+	}
+	size_t start = ptr - c.data;
+	if (start + p_new_bytes > c.size) {
+		return false;
+	}
+	size_t old_used = _get_used();
+	offset = start + p_new_bytes;
+	_update_usage(old_used);
+	return true;
+}
+
+void FrameArena::rewind(const Mark &p_mark) {
+	ERR_FAIL_COND(p_mark.chunk > chunk || (p_mark.chunk == chunk && p_mark.offset > offset));
+	size_t old_used = _get_used();
+	chunk = p_mark.chunk;
+	offset = p_mark.offset;
+	chunk_base = p_mark.chunk_base;
+	_update_usage(old_used);
+}
+
+void FrameArena::reset() {
+	ERR_FAIL_COND_MSG(scope_depth > 0, "Can't reset a frame arena while a scope is open on it.");
+	rewind(Mark());
+
+	// If the previous frame needed several chunks, merge them into a single one
+	// big enough for all of them, so the next frame doesn't need to chain them.
+	if (chunks.size() > 1) {
+		size_t total = get_capacity();
+		_free_chunks();
+		Chunk c;
+		c.size = nearest_power_of_2_templated(total);
+		c.data = (uint8_t *)memalloc(c.size);
+		CRASH_COND_MSG(!c.data, "Out of memory");
+		chunks.push_back(c);
+	}
+}
+
+size_t FrameArena::get_capacity() const {
+	size_t capacity = 0;
+	for (const Chunk &c : chunks) {
+		capacity += c.size;
+	}
+	return capacity;
+}
+
+void FrameArena::end_frame() {
+	ERR_FAIL_COND_MSG(!Thread::is_main_thread(), "Frame arenas can only be advanced from the main thread.");
+	thread_arena.reset();
+
+	uint64_t peak = frame_peak_usage.get();
+	last_frame_peak_usage.set(peak);
+	max_peak_usage.exchange_if_greater(peak);
+	// Allocations still alive on other threads carry over to the next frame.
+	frame_peak_usage.set(usage.get());
+}
+
+FrameArena::~FrameArena() {
+	size_t old_used = _get_used();
+	chunk = 0;
+	offset = 0;
+	chunk_base = 0;
+	_update_usage(old_used);
+	_free_chunks();
+}
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// Thread-local bump allocator for short lived, per-frame data.
+//
+// Each thread owns its own arena, so allocating never locks. Memory is never
+// freed individually: either a Scope rewinds the arena to where it was when
+// the scope was opened, or the whole main thread arena is reset once per frame
+// by Main::iteration(). Anything allocated from the arena must not outlive the
+// scope (or the frame) it was allocated in, and must be trivially destructible.
+class FrameArena {
+public:
+	struct Mark {
+		uint32_t chunk = 0;
+		size_t offset = 0;
+		size_t chunk_base = 0;
+	};
+
+	// Rewinds the current thread's arena when going out of scope.
+	class Scope {
+		FrameArena *arena = nullptr;
+		Mark mark;
+
+	public:
+		Scope();
+		~Scope();
+	};
+
+private:
+	static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
+
+	struct Chunk {
+		uint8_t *data = nullptr;
+		size_t size = 0;
+	};
+
+	LocalVector<Chunk> chunks;
+	uint32_t chunk = 0; // Chunk currently being allocated from.
+	size_t offset = 0; // Offset into the current chunk.
+	size_t chunk_base = 0; // Size of all the chunks before the current one.
+	uint32_t scope_depth = 0;
+
+	static thread_local FrameArena thread_arena;
+
+	// Bytes currently allocated from all the arenas, and its high-water marks.
+	static SafeNumeric<uint64_t> usage;
+	static SafeNumeric<uint64_t> frame_peak_usage;
+	static SafeNumeric<uint64_t> last_frame_peak_usage;
+	static SafeNumeric<uint64_t> max_peak_usage;
+
+	_FORCE_INLINE_ size_t _get_used() const { return chunk_base + offset; }
+	void _update_usage(size_t p_old_used);
+	void _free_chunks();
+
+public:
+	_FORCE_INLINE_ static FrameArena *get_thread_arena() { return &thread_arena; }
+
+	void *alloc(size_t p_bytes, size_t p_alignment = alignof(max_align_t));
+	// Grows the last allocation in place if there is room left in its chunk.
+	bool extend(void *p_ptr, size_t p_old_bytes, size_t p_new_bytes);
+
+	template <typename T>
+	_FORCE_INLINE_ T *alloc_array(size_t p_count) {
+		static_assert(std::is_trivially_destructible_v<T>, "Frame arena memory is never destructed.");
+		return (T *)alloc(p_count * sizeof(T), alignof(T));
+	}
+
+	template <typename T, typename... Args>
+	_FORCE_INLINE_ T *alloc_new(Args &&...p_args) {
+		static_assert(std::is_trivially_destructible_v<T>, "Frame arena memory is never destructed.");
+		return memnew_placement(alloc(sizeof(T), alignof(T)), T(std::forward<Args>(p_args)...));
+	}
+
+	_FORCE_INLINE_ Mark get_mark() const { return Mark{ chunk, offset, chunk_base }; }
+	void rewind(const Mark &p_mark);
+	void reset();
+
+	_FORCE_INLINE_ size_t get_used() const { return _get_used(); }
+	size_t get_capacity() const;
+
+	// Called once per frame from the main thread by Main::iteration().
+	static void end_frame();
+
+	static uint64_t get_usage() { return usage.get(); }
+	// High-water mark of the last completed frame.
+	static uint64_t get_frame_peak_usage() { return last_frame_peak_usage.get(); }
+	static uint64_t get_max_peak_usage() { return max_peak_usage.get(); }
+
+	FrameArena() {}
+	~FrameArena();
+};
+
+#endif // FRAME_ARENA_H
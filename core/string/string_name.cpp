@@ -135,28 +135,35 @@ void StringName::unref() {
 	ERR_FAIL_COND(!configured);
 
 	if (_data && _data->refcount.unref()) {
-		MutexLock lock(mutex);
-
-		if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
-			if (_data->cname) {
-				ERR_PRINT("BUG: Unreferenced static string to 0: " + String(_data->cname));
+		// Printing can create or release StringNames in the same shard, and the shard locks
+		// aren't recursive. Errors are collected here and only printed once the lock is released.
+		String unreferenced_static_name;
+		bool table_bug = false;
+		{
+			MutexLock lock(_get_table_lock(_data->idx));
+
+			if (CoreGlobals::leak_reporting_enabled && _data->static_count.get() > 0) {
+				unreferenced_static_name = _data->cname ? String(_data->cname) : _data->name;
+			}
+			if (_data->prev) {
+				_data->prev->next = _data->next;
 			} else {
-				ERR_PRINT("BUG: Unreferenced static string to 0: " + String(_data->name));
+				table_bug = _table[_data->idx] != _data;
+				_table[_data->idx] = _data->next;
 			}
-		}
-		if (_data->prev) {
-			_data->prev->next = _data->next;
-		} else {
-			if (_table[_data->idx] != _data) {
-				ERR_PRINT("BUG!");
+
+			if (_data->next) {
+				_data->next->prev = _data->prev;
 			}
-			_table[_data->idx] = _data->next;
+			memdelete(_data);
 		}
 
-		if (_data->next) {
-			_data->next->prev = _data->prev;
+		if (!unreferenced_static_name.is_empty()) {
+			ERR_PRINT("BUG: Unreferenced static string to 0: " + unreferenced_static_name);
+		}
+		if (table_bug) {
+			ERR_PRINT("BUG!");
 		}
-		memdelete(_data);
 	}
 
 	_data = nullptr;
@@ -269,11 +276,10 @@ StringName::StringName(const char *p_name, bool p_static) {
 		return; //empty, ignore
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(_get_table_lock(idx));
 
 	_data = _table[idx];
 
@@ -328,11 +334,10 @@ StringName::StringName(const StaticCString &p_static_string, bool p_static) {
 
 	ERR_FAIL_COND(!p_static_string.ptr || !p_static_string.ptr[0]);
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_static_string.ptr);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(_get_table_lock(idx));
 
 	_data = _table[idx];
 
@@ -388,10 +393,9 @@ StringName::StringName(const String &p_name, bool p_static) {
 		return;
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(_get_table_lock(idx));
 
 	_data = _table[idx];
 
@@ -446,10 +450,9 @@ StringName StringName::search(const char *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(_get_table_lock(idx));
 
 	_Data *_data = _table[idx];
 
@@ -482,11 +485,10 @@ StringName StringName::search(const char32_t *p_name) {
 		return StringName();
 	}
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = String::hash(p_name);
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(_get_table_lock(idx));
 
 	_Data *_data = _table[idx];
 
@@ -508,11 +510,10 @@ StringName StringName::search(const char32_t *p_name) {
 StringName StringName::search(const String &p_name) {
 	ERR_FAIL_COND_V(p_name.is_empty(), StringName());
 
-	MutexLock lock(mutex);
-
 	uint32_t hash = p_name.hash();
 
 	uint32_t idx = hash & STRING_TABLE_MASK;
+	MutexLock lock(_get_table_lock(idx));
 
 	_Data *_data = _table[idx];
 
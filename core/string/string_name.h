@@ -48,7 +48,10 @@ class StringName {
 	enum {
 		STRING_TABLE_BITS = 16,
 		STRING_TABLE_LEN = 1 << STRING_TABLE_BITS,
-		STRING_TABLE_MASK = STRING_TABLE_LEN - 1
+		STRING_TABLE_MASK = STRING_TABLE_LEN - 1,
+		STRING_TABLE_LOCK_BITS = 6,
+		STRING_TABLE_LOCK_COUNT = 1 << STRING_TABLE_LOCK_BITS,
+		STRING_TABLE_LOCK_MASK = STRING_TABLE_LOCK_COUNT - 1
 	};
 
 	struct _Data {
@@ -81,6 +84,9 @@ class StringName {
 	friend void unregister_core_types();
 	friend class Main;
 	static inline Mutex mutex;
+	// Each table bucket is guarded by one of these locks, so threads looking up different names rarely contend.
+	static inline BinaryMutex table_locks[STRING_TABLE_LOCK_COUNT];
+	_FORCE_INLINE_ static BinaryMutex &_get_table_lock(uint32_t p_idx) { return table_locks[p_idx & STRING_TABLE_LOCK_MASK]; }
 	static void setup();
 	static void cleanup();
 	static uint32_t get_empty_hash();
@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*  arena_vector.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef ARENA_VECTOR_H
+#define ARENA_VECTOR_H
+
+#include "core/error/error_macros.h"
+#include "core/os/frame_arena.h"
+#include "core/templates/sort_array.h"
+
+#include <cstring>
+#include <type_traits>
+
+// LocalVector-like container whose storage comes from the current thread's
+// FrameArena. It never frees its memory, which is reclaimed in bulk when the
+// arena is rewound, so it must not outlive the FrameArena::Scope (or frame) it
+// was filled in. Storage is taken from the arena of the thread that first
+// grows the vector, and it must only be grown from that thread afterwards.
+template <typename T, typename U = uint32_t>
+class ArenaVector {
+	static_assert(std::is_trivially_destructible_v<T>, "ArenaVector elements are never destructed.");
+
+private:
+	FrameArena *arena = nullptr;
+	U count = 0;
+	U capacity = 0;
+	T *data = nullptr;
+
+	void _grow(U p_capacity) {
+		if (!arena) {
+			arena = FrameArena::get_thread_arena();
+		}
+		DEV_ASSERT(arena == FrameArena::get_thread_arena());
+		if (data && arena->extend(data, capacity * sizeof(T), p_capacity * sizeof(T))) {
+			capacity = p_capacity;
+			return;
+		}
+		T *new_data = arena->alloc_array<T>(p_capacity);
+		if (count) {
+			memcpy((void *)new_data, (const void *)data, count * sizeof(T));
+		}
+		data = new_data;
+		capacity = p_capacity;
+	}
+
+public:
+	T *ptr() {
+		return data;
+	}
+
+	const T *ptr() const {
+		return data;
+	}
+
+	_FORCE_INLINE_ void push_back(T p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(MAX(capacity << 1, U(4)));
+		}
+		memnew_placement(&data[count++], T(std::move(p_elem)));
+	}
+
+	void remove_at_unordered(U p_index) {
+		ERR_FAIL_INDEX(p_index, count);
+		count--;
+		if (count > p_index) {
+			data[p_index] = std::move(data[count]);
+		}
+	}
+
+	_FORCE_INLINE_ void clear() { count = 0; }
+	// Forgets the storage without touching the arena, for when the arena is about to be rewound.
+	_FORCE_INLINE_ void reset() {
+		arena = nullptr;
+		count = 0;
+		capacity = 0;
+		data = nullptr;
+	}
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	_FORCE_INLINE_ void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(p_size);
+		}
+	}
+
+	_FORCE_INLINE_ U size() const { return count; }
+	void resize(U p_size) {
+		if (p_size > count) {
+			if (unlikely(p_size > capacity)) {
+				_grow(MAX(nearest_power_of_2_templated(p_size), U(4)));
+			}
+			if constexpr (!std::is_trivially_constructible_v<T>) {
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&data[i], T);
+				}
+			}
+		}
+		count = p_size;
+	}
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+
+	int64_t find(const T &p_val, U p_from = 0) const {
+		for (U i = p_from; i < count; i++) {
+			if (data[i] == p_val) {
+				return int64_t(i);
+			}
+		}
+		return -1;
+	}
+
+	bool has(const T &p_val) const {
+		return find(p_val) != -1;
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (count == 0) {
+			return;
+		}
+
+		SortArray<T, C> sorter;
+		sorter.sort(data, count);
+	}
+
+	void sort() {
+		sort_custom<_DefaultComparator<T>>();
+	}
+
+	_FORCE_INLINE_ ArenaVector() {}
+	// Copies would alias the same arena storage.
+	ArenaVector(const ArenaVector &p_from) = delete;
+	void operator=(const ArenaVector &p_from) = delete;
+	_FORCE_INLINE_ ArenaVector(ArenaVector &&p_from) {
+		arena = p_from.arena;
+		count = p_from.count;
+		capacity = p_from.capacity;
+		data = p_from.data;
+		p_from.reset();
+	}
+	inline void operator=(ArenaVector &&p_from) {
+		if (unlikely(this == &p_from)) {
+			return;
+		}
+		arena = p_from.arena;
+		count = p_from.count;
+		capacity = p_from.capacity;
+		data = p_from.data;
+		p_from.reset();
+	}
+};
+
+#endif // ARENA_VECTOR_H
@@ -0,0 +1,281 @@
+/**************************************************************************/
+/*  small_vector.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "core/error/error_macros.h"
+#include "core/os/memory.h"
+#include "core/templates/sort_array.h"
+
+#include <cstring>
+#include <initializer_list>
+#include <type_traits>
+
+// LocalVector-like container that stores up to N elements inline, so short lists
+// don't allocate. It only goes to the heap once it grows past N elements.
+// Like LocalVector, elements are assumed to be relocatable with a plain memory copy.
+template <typename T, uint32_t N, typename U = uint32_t>
+class SmallVector {
+	static_assert(N > 0, "SmallVector needs at least one inline element.");
+
+private:
+	U count = 0;
+	U capacity = N;
+	T *data = reinterpret_cast<T *>(inline_data);
+	alignas(T) uint8_t inline_data[sizeof(T) * N];
+
+	_FORCE_INLINE_ bool _is_inline() const { return data == reinterpret_cast<const T *>(inline_data); }
+
+	void _grow(U p_capacity) {
+		if (_is_inline()) {
+			T *new_data = (T *)memalloc(p_capacity * sizeof(T));
+			CRASH_COND_MSG(!new_data, "Out of memory");
+			if (count) {
+				memcpy((void *)new_data, (const void *)data, count * sizeof(T));
+			}
+			data = new_data;
+		} else {
+			data = (T *)memrealloc(data, p_capacity * sizeof(T));
+			CRASH_COND_MSG(!data, "Out of memory");
+		}
+		capacity = p_capacity;
+	}
+
+	void _take(SmallVector &p_from) {
+		if (p_from._is_inline()) {
+			for (U i = 0; i < p_from.count; i++) {
+				memnew_placement(&data[i], T(std::move(p_from.data[i])));
+			}
+			count = p_from.count;
+			p_from.clear();
+		} else {
+			data = p_from.data;
+			count = p_from.count;
+			capacity = p_from.capacity;
+
+			p_from.data = reinterpret_cast<T *>(p_from.inline_data);
+			p_from.count = 0;
+			p_from.capacity = N;
+		}
+	}
+
+public:
+	T *ptr() {
+		return data;
+	}
+
+	const T *ptr() const {
+		return data;
+	}
+
+	_FORCE_INLINE_ void push_back(T p_elem) {
+		if (unlikely(count == capacity)) {
+			_grow(capacity << 1);
+		}
+
+		if constexpr (!std::is_trivially_constructible_v<T>) {
+			memnew_placement(&data[count++], T(std::move(p_elem)));
+		} else {
+			data[count++] = std::move(p_elem);
+		}
+	}
+
+	void remove_at(U p_index) {
+		ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+		count--;
+		for (U i = p_index; i < count; i++) {
+			data[i] = std::move(data[i + 1]);
+		}
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			data[count].~T();
+		}
+	}
+
+	/// Removes the item copying the last value into the position of the one to
+	/// remove. It's generally faster than `remove_at`.
+	void remove_at_unordered(U p_index) {
+		ERR_FAIL_INDEX(p_index, count);
+		count--;
+		if (count > p_index) {
+			data[p_index] = std::move(data[count]);
+		}
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			data[count].~T();
+		}
+	}
+
+	_FORCE_INLINE_ bool erase(const T &p_val) {
+		int64_t idx = find(p_val);
+		if (idx >= 0) {
+			remove_at(idx);
+			return true;
+		}
+		return false;
+	}
+
+	void invert() {
+		for (U i = 0; i < count / 2; i++) {
+			SWAP(data[i], data[count - i - 1]);
+		}
+	}
+
+	_FORCE_INLINE_ void clear() { resize(0); }
+	// Also releases the heap storage, going back to the inline buffer.
+	_FORCE_INLINE_ void reset() {
+		clear();
+		if (!_is_inline()) {
+			memfree(data);
+			data = reinterpret_cast<T *>(inline_data);
+			capacity = N;
+		}
+	}
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ bool is_inline() const { return _is_inline(); }
+	_FORCE_INLINE_ U get_capacity() const { return capacity; }
+	_FORCE_INLINE_ void reserve(U p_size) {
+		if (p_size > capacity) {
+			_grow(nearest_power_of_2_templated(p_size));
+		}
+	}
+
+	_FORCE_INLINE_ U size() const { return count; }
+	void resize(U p_size) {
+		if (p_size < count) {
+			if constexpr (!std::is_trivially_destructible_v<T>) {
+				for (U i = p_size; i < count; i++) {
+					data[i].~T();
+				}
+			}
+			count = p_size;
+		} else if (p_size > count) {
+			if (unlikely(p_size > capacity)) {
+				_grow(nearest_power_of_2_templated(p_size));
+			}
+			if constexpr (!std::is_trivially_constructible_v<T>) {
+				for (U i = count; i < p_size; i++) {
+					memnew_placement(&data[i], T);
+				}
+			}
+			count = p_size;
+		}
+	}
+	_FORCE_INLINE_ const T &operator[](U p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+	_FORCE_INLINE_ T &operator[](U p_index) {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, count);
+		return data[p_index];
+	}
+
+	_FORCE_INLINE_ T *begin() { return data; }
+	_FORCE_INLINE_ T *end() { return data + count; }
+	_FORCE_INLINE_ const T *begin() const { return data; }
+	_FORCE_INLINE_ const T *end() const { return data + count; }
+
+	void insert(U p_pos, T p_val) {
+		ERR_FAIL_UNSIGNED_INDEX(p_pos, count + 1);
+		if (p_pos == count) {
+			push_back(std::move(p_val));
+		} else {
+			resize(count + 1);
+			for (U i = count - 1; i > p_pos; i--) {
+				data[i] = std::move(data[i - 1]);
+			}
+			data[p_pos] = std::move(p_val);
+		}
+	}
+
+	int64_t find(const T &p_val, U p_from = 0) const {
+		for (U i = p_from; i < count; i++) {
+			if (data[i] == p_val) {
+				return int64_t(i);
+			}
+		}
+		return -1;
+	}
+
+	bool has(const T &p_val) const {
+		return find(p_val) != -1;
+	}
+
+	template <typename C>
+	void sort_custom() {
+		U len = count;
+		if (len == 0) {
+			return;
+		}
+
+		SortArray<T, C> sorter;
+		sorter.sort(data, len);
+	}
+
+	void sort() {
+		sort_custom<_DefaultComparator<T>>();
+	}
+
+	_FORCE_INLINE_ SmallVector() {}
+	_FORCE_INLINE_ SmallVector(std::initializer_list<T> p_init) {
+		reserve(p_init.size());
+		for (const T &element : p_init) {
+			push_back(element);
+		}
+	}
+	_FORCE_INLINE_ SmallVector(const SmallVector &p_from) {
+		resize(p_from.size());
+		for (U i = 0; i < p_from.count; i++) {
+			data[i] = p_from.data[i];
+		}
+	}
+	_FORCE_INLINE_ SmallVector(SmallVector &&p_from) {
+		_take(p_from);
+	}
+
+	inline void operator=(const SmallVector &p_from) {
+		resize(p_from.size());
+		for (U i = 0; i < p_from.count; i++) {
+			data[i] = p_from.data[i];
+		}
+	}
+	inline void operator=(SmallVector &&p_from) {
+		if (unlikely(this == &p_from)) {
+			return;
+		}
+		reset();
+		_take(p_from);
+	}
+
+	_FORCE_INLINE_ ~SmallVector() {
+		reset();
+	}
+};
+
+#endif // SMALL_VECTOR_H
@@ -48,6 +48,7 @@
 #include "core/io/resource_loader.h"
 #include "core/object/message_queue.h"
 #include "core/object/script_language.h"
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/os/time.h"
 #include "core/register_core_types.h"
@@ -1892,7 +1893,8 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 		} else {
 			int worker_threads = GLOBAL_GET("threading/worker_pool/max_threads");
 			float low_priority_ratio = GLOBAL_GET("threading/worker_pool/low_priority_thread_ratio");
-			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio);
+			bool work_stealing = GLOBAL_GET("threading/worker_pool/work_stealing");
+			WorkerThreadPool::get_singleton()->init(worker_threads, low_priority_ratio, work_stealing);
 		}
 #else
 		WorkerThreadPool::get_singleton()->init(0, 0);
@@ -4511,6 +4513,9 @@ bool Main::iteration() {
 	frames++;
 	Engine::get_singleton()->_process_frames++;
 
+	// Releases everything allocated from the main thread's frame arena this frame.
+	FrameArena::end_frame();
+
 	if (frame > 1000000) {
 		// Wait a few seconds before printing FPS, as FPS reporting just after the engine has started is inaccurate.
 		if (hide_print_fps_attempts == 0) {
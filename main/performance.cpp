@@ -30,6 +30,7 @@
 
 #include "performance.h"
 
+#include "core/os/frame_arena.h"
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
@@ -97,6 +98,12 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SURFACE);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_DRAW);
 	BIND_ENUM_CONSTANT(PIPELINE_COMPILATIONS_SPECIALIZATION);
+	BIND_ENUM_CONSTANT(MEMORY_FRAME_ARENA_PEAK);
+	BIND_ENUM_CONSTANT(MEMORY_FRAME_ARENA_MAX);
+#ifndef _3D_DISABLED
+	BIND_ENUM_CONSTANT(PHYSICS_3D_TEMP_MEMORY_PEAK);
+	BIND_ENUM_CONSTANT(PHYSICS_3D_TEMP_MEMORY_CAPACITY);
+#endif // _3D_DISABLED
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -151,6 +158,10 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("pipeline/compilations_surface"),
 		PNAME("pipeline/compilations_draw"),
 		PNAME("pipeline/compilations_specialization"),
+		PNAME("memory/frame_arena_peak"),
+		PNAME("memory/frame_arena_max"),
+		PNAME("physics_3d/temp_memory_peak"),
+		PNAME("physics_3d/temp_memory_capacity"),
 	};
 
 	return names[p_monitor];
@@ -202,6 +213,10 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW);
 		case PIPELINE_COMPILATIONS_SPECIALIZATION:
 			return RS::get_singleton()->get_rendering_info(RS::RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION);
+		case MEMORY_FRAME_ARENA_PEAK:
+			return FrameArena::get_frame_peak_usage();
+		case MEMORY_FRAME_ARENA_MAX:
+			return FrameArena::get_max_peak_usage();
 		case PHYSICS_2D_ACTIVE_OBJECTS:
 			return PhysicsServer2D::get_singleton()->get_process_info(PhysicsServer2D::INFO_ACTIVE_OBJECTS);
 		case PHYSICS_2D_COLLISION_PAIRS:
@@ -215,6 +230,10 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return 0;
 		case PHYSICS_3D_ISLAND_COUNT:
 			return 0;
+		case PHYSICS_3D_TEMP_MEMORY_PEAK:
+			return 0;
+		case PHYSICS_3D_TEMP_MEMORY_CAPACITY:
+			return 0;
 #else
 		case PHYSICS_3D_ACTIVE_OBJECTS:
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ACTIVE_OBJECTS);
@@ -222,6 +241,10 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_COLLISION_PAIRS);
 		case PHYSICS_3D_ISLAND_COUNT:
 			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_ISLAND_COUNT);
+		case PHYSICS_3D_TEMP_MEMORY_PEAK:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_TEMP_MEMORY_PEAK);
+		case PHYSICS_3D_TEMP_MEMORY_CAPACITY:
+			return PhysicsServer3D::get_singleton()->get_process_info(PhysicsServer3D::INFO_TEMP_MEMORY_CAPACITY);
 #endif // _3D_DISABLED
 
 		case AUDIO_OUTPUT_LATENCY:
@@ -292,6 +315,15 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
+		MONITOR_TYPE_MEMORY,
 
 	};
 
@@ -106,6 +106,10 @@ public:
 		PIPELINE_COMPILATIONS_SURFACE,
 		PIPELINE_COMPILATIONS_DRAW,
 		PIPELINE_COMPILATIONS_SPECIALIZATION,
+		MEMORY_FRAME_ARENA_PEAK,
+		MEMORY_FRAME_ARENA_MAX,
+		PHYSICS_3D_TEMP_MEMORY_PEAK,
+		PHYSICS_3D_TEMP_MEMORY_CAPACITY,
 		MONITOR_MAX
 	};
 
@@ -34,6 +34,8 @@
 
 #include "core/debugger/engine_debugger.h"
 
+bool GDScriptByteCodeGenerator::superinstructions_enabled = true;
+
 uint32_t GDScriptByteCodeGenerator::add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) {
 	function->_argument_count++;
 	function->argument_types.push_back(p_type);
@@ -615,6 +617,7 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		int position = opcodes.size();
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -623,6 +626,12 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 #ifdef DEBUG_ENABLED
 		add_debug_name(operator_names, get_operation_pos(op_func), Variant::get_operator_name(p_operator));
 #endif
+
+		last_operator.position = position;
+		last_operator.op = p_operator;
+		last_operator.left_operand = p_left_operand;
+		last_operator.right_operand = p_right_operand;
+		last_operator.target = p_target;
 		return;
 	}
 
@@ -640,6 +649,58 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 	}
 }
 
+void GDScriptByteCodeGenerator::append_jump_if_not(const Address &p_condition) {
+	// Fuse a boolean operator with the conditional jump that consumes its result.
+	if (is_last_operator_fusable(p_condition) && Variant::get_operator_return_type(last_operator.op, last_operator.left_operand.type.builtin_type, last_operator.right_operand.type.builtin_type) == Variant::BOOL) {
+		opcodes.write[last_operator.position] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+		last_operator.position = -1;
+		return;
+	}
+
+	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
+	append(p_condition);
+}
+
+bool GDScriptByteCodeGenerator::fuse_increment(const Address &p_target, const Address &p_source) {
+	// Turn `x = x + y` (and subtraction) on a typed `int` or `float` local into an in-place update.
+	if (!is_last_operator_fusable(p_source)) {
+		return false;
+	}
+	if (last_operator.op != Variant::OP_ADD && last_operator.op != Variant::OP_SUBTRACT) {
+		return false;
+	}
+
+	const Address &left = last_operator.left_operand;
+	if (p_target.mode != Address::LOCAL_VARIABLE || left.mode != Address::LOCAL_VARIABLE || left.address != p_target.address) {
+		return false;
+	}
+	if (!HAS_BUILTIN_TYPE(p_target) || p_target.type.builtin_type != left.type.builtin_type || left.type.builtin_type != last_operator.right_operand.type.builtin_type) {
+		return false;
+	}
+
+	GDScriptFunction::Opcode opcode;
+	switch (left.type.builtin_type) {
+		case Variant::INT:
+			opcode = last_operator.op == Variant::OP_ADD ? GDScriptFunction::OPCODE_INCREMENT_INT : GDScriptFunction::OPCODE_DECREMENT_INT;
+			break;
+		case Variant::FLOAT:
+			opcode = last_operator.op == Variant::OP_ADD ? GDScriptFunction::OPCODE_INCREMENT_FLOAT : GDScriptFunction::OPCODE_DECREMENT_FLOAT;
+			break;
+		default:
+			return false;
+	}
+
+	// The operands stay in place, only the temporary result is dropped.
+	Vector<int> &result_indices = temporaries.write[last_operator.target.address].bytecode_indices;
+	ERR_FAIL_COND_V(result_indices.is_empty() || result_indices[result_indices.size() - 1] != last_operator.position + 3, false);
+	result_indices.resize(result_indices.size() - 1);
+
+	opcodes.write[last_operator.position] = opcode;
+	opcodes.resize(last_operator.position + 3);
+	last_operator.position = -1;
+	return true;
+}
+
 void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const Address &p_source, const GDScriptDataType &p_type) {
 	switch (p_type.kind) {
 		case GDScriptDataType::BUILTIN: {
@@ -693,15 +754,13 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 }
 
 void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	append_jump_if_not(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	append_jump_if_not(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -757,8 +816,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -967,7 +1025,32 @@ void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_ta
 	}
 }
 
+static GDScriptFunction::Opcode get_unboxed_assign_opcode(Variant::Type p_type) {
+	switch (p_type) {
+		case Variant::BOOL:
+			return GDScriptFunction::OPCODE_ASSIGN_BOOL;
+		case Variant::INT:
+			return GDScriptFunction::OPCODE_ASSIGN_INT;
+		case Variant::FLOAT:
+			return GDScriptFunction::OPCODE_ASSIGN_FLOAT;
+		case Variant::VECTOR2:
+			return GDScriptFunction::OPCODE_ASSIGN_VECTOR2;
+		case Variant::VECTOR2I:
+			return GDScriptFunction::OPCODE_ASSIGN_VECTOR2I;
+		case Variant::VECTOR3:
+			return GDScriptFunction::OPCODE_ASSIGN_VECTOR3;
+		case Variant::VECTOR3I:
+			return GDScriptFunction::OPCODE_ASSIGN_VECTOR3I;
+		default:
+			return GDScriptFunction::OPCODE_ASSIGN; // Not a plain value type.
+	}
+}
+
 void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Address &p_source) {
+	if (fuse_increment(p_target, p_source)) {
+		return;
+	}
+
 	if (p_target.type.kind == GDScriptDataType::BUILTIN && p_target.type.builtin_type == Variant::ARRAY && p_target.type.has_container_element_type(0)) {
 		const GDScriptDataType &element_type = p_target.type.get_container_element_type(0);
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY);
@@ -994,6 +1077,11 @@ void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Addr
 		append(p_target);
 		append(p_source);
 		append(p_target.type.builtin_type);
+	} else if (HAS_BUILTIN_TYPE(p_target) && HAS_BUILTIN_TYPE(p_source) && get_unboxed_assign_opcode(p_target.type.builtin_type) != GDScriptFunction::OPCODE_ASSIGN) {
+		// Same plain type on both sides, copy the value directly.
+		append_opcode(get_unboxed_assign_opcode(p_target.type.builtin_type));
+		append(p_target);
+		append(p_source);
 	} else {
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN);
 		append(p_target);
@@ -1023,6 +1111,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 		write_assign(p_dst, p_src);
 	}
 	function->default_arguments.push_back(opcodes.size());
+	last_operator.position = -1; // Default argument entry point.
 }
 
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
@@ -1512,8 +1601,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1719,12 +1807,12 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_operator.position = -1; // Loop start is a jump target.
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	append_jump_if_not(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -158,6 +158,24 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Last validated operator written, so the next instruction can be fused with it (peephole optimization).
+	// Only valid while it's the last instruction and nothing may jump right after it.
+	struct FusableOperator {
+		int position = -1;
+		Variant::Operator op = Variant::OP_MAX;
+		Address left_operand;
+		Address right_operand;
+		Address target;
+	};
+	FusableOperator last_operator;
+
+	bool is_last_operator_fusable(const Address &p_target) const {
+		return superinstructions_enabled && last_operator.position >= 0 && last_operator.position + 5 == opcodes.size() && p_target.mode == Address::TEMPORARY && last_operator.target.mode == Address::TEMPORARY && p_target.address == last_operator.target.address;
+	}
+
+	void append_jump_if_not(const Address &p_condition);
+	bool fuse_increment(const Address &p_target, const Address &p_source);
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -449,9 +467,13 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		last_operator.position = -1; // Current position is now a jump target.
 	}
 
 public:
+	// Fused instructions can be turned off to compare against the plain bytecode, e.g. in benchmarks.
+	static bool superinstructions_enabled;
+
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local_constant(const StringName &p_name, const Variant &p_constant) override;
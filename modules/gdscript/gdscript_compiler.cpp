@@ -2051,9 +2051,22 @@ Error GDScriptCompiler::_parse_block(CodeGen &codegen, const GDScriptParser::Sui
 
 				GDScriptCodeGenerator::Address iterator = codegen.add_local(for_n->variable->name, _gdtype_from_datatype(for_n->variable->get_datatype(), codegen.script));
 
-				gen->start_for(iterator.type, _gdtype_from_datatype(for_n->list->get_datatype(), codegen.script));
+				// Iterate `range()` with a single typed `int` argument like an `int` instead of allocating an array.
+				// Constant calls are already reduced by the analyzer.
+				const GDScriptParser::ExpressionNode *list_node = for_n->list;
+				if (GDScriptByteCodeGenerator::superinstructions_enabled && !list_node->is_constant && list_node->type == GDScriptParser::Node::CALL) {
+					const GDScriptParser::CallNode *call = static_cast<const GDScriptParser::CallNode *>(list_node);
+					if (call->get_callee_type() == GDScriptParser::Node::IDENTIFIER && static_cast<const GDScriptParser::IdentifierNode *>(call->callee)->name == "range" && call->arguments.size() == 1) {
+						const GDScriptParser::DataType arg_type = call->arguments[0]->get_datatype();
+						if (arg_type.is_hard_type() && arg_type.kind == GDScriptParser::DataType::BUILTIN && arg_type.builtin_type == Variant::INT) {
+							list_node = call->arguments[0];
+						}
+					}
+				}
+
+				gen->start_for(iterator.type, _gdtype_from_datatype(list_node->get_datatype(), codegen.script));
 
-				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, for_n->list);
+				GDScriptCodeGenerator::Address list = _parse_expression(codegen, err, list_node);
 				if (err) {
 					return err;
 				}
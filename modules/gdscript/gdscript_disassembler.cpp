@@ -141,6 +141,39 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 5;
 			} break;
+			case OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				text += "validated operator ";
+
+				text += DADDR(3);
+				text += " = ";
+				text += DADDR(1);
+				text += " ";
+				text += operator_names[_code_ptr[ip + 4]];
+				text += " ";
+				text += DADDR(2);
+				text += " jump-if-not to ";
+				text += itos(_code_ptr[ip + 5]);
+
+				incr += 6;
+			} break;
+			case OPCODE_INCREMENT_INT:
+			case OPCODE_INCREMENT_FLOAT: {
+				text += "increment ";
+				text += DADDR(1);
+				text += " += ";
+				text += DADDR(2);
+
+				incr += 3;
+			} break;
+			case OPCODE_DECREMENT_INT:
+			case OPCODE_DECREMENT_FLOAT: {
+				text += "decrement ";
+				text += DADDR(1);
+				text += " -= ";
+				text += DADDR(2);
+
+				incr += 3;
+			} break;
 			case OPCODE_TYPE_TEST_BUILTIN: {
 				text += "type test ";
 				text += DADDR(1);
@@ -411,6 +444,20 @@ void GDScriptFunction::disassemble(const Vector<String> &p_code_lines) const {
 
 				incr += 3;
 			} break;
+			case OPCODE_ASSIGN_BOOL:
+			case OPCODE_ASSIGN_INT:
+			case OPCODE_ASSIGN_FLOAT:
+			case OPCODE_ASSIGN_VECTOR2:
+			case OPCODE_ASSIGN_VECTOR2I:
+			case OPCODE_ASSIGN_VECTOR3:
+			case OPCODE_ASSIGN_VECTOR3I: {
+				text += "assign unboxed ";
+				text += DADDR(1);
+				text += " = ";
+				text += DADDR(2);
+
+				incr += 3;
+			} break;
 			case OPCODE_ASSIGN_NULL: {
 				text += "assign ";
 				text += DADDR(1);
@@ -257,6 +257,11 @@ public:
 	enum Opcode {
 		OPCODE_OPERATOR,
 		OPCODE_OPERATOR_VALIDATED,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,
+		OPCODE_INCREMENT_INT,
+		OPCODE_INCREMENT_FLOAT,
+		OPCODE_DECREMENT_INT,
+		OPCODE_DECREMENT_FLOAT,
 		OPCODE_TYPE_TEST_BUILTIN,
 		OPCODE_TYPE_TEST_ARRAY,
 		OPCODE_TYPE_TEST_DICTIONARY,
@@ -280,6 +285,13 @@ public:
 		OPCODE_ASSIGN_NULL,
 		OPCODE_ASSIGN_TRUE,
 		OPCODE_ASSIGN_FALSE,
+		OPCODE_ASSIGN_BOOL,
+		OPCODE_ASSIGN_INT,
+		OPCODE_ASSIGN_FLOAT,
+		OPCODE_ASSIGN_VECTOR2,
+		OPCODE_ASSIGN_VECTOR2I,
+		OPCODE_ASSIGN_VECTOR3,
+		OPCODE_ASSIGN_VECTOR3I,
 		OPCODE_ASSIGN_TYPED_BUILTIN,
 		OPCODE_ASSIGN_TYPED_ARRAY,
 		OPCODE_ASSIGN_TYPED_DICTIONARY,
@@ -232,6 +232,11 @@ void (*type_init_function_table[])(Variant *) = {
 	static const void *switch_table_ops[] = {            \
 		&&OPCODE_OPERATOR,                               \
 		&&OPCODE_OPERATOR_VALIDATED,                     \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,         \
+		&&OPCODE_INCREMENT_INT,                          \
+		&&OPCODE_INCREMENT_FLOAT,                        \
+		&&OPCODE_DECREMENT_INT,                          \
+		&&OPCODE_DECREMENT_FLOAT,                        \
 		&&OPCODE_TYPE_TEST_BUILTIN,                      \
 		&&OPCODE_TYPE_TEST_ARRAY,                        \
 		&&OPCODE_TYPE_TEST_DICTIONARY,                   \
@@ -255,6 +260,13 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_ASSIGN_NULL,                            \
 		&&OPCODE_ASSIGN_TRUE,                            \
 		&&OPCODE_ASSIGN_FALSE,                           \
+		&&OPCODE_ASSIGN_BOOL,                            \
+		&&OPCODE_ASSIGN_INT,                             \
+		&&OPCODE_ASSIGN_FLOAT,                           \
+		&&OPCODE_ASSIGN_VECTOR2,                         \
+		&&OPCODE_ASSIGN_VECTOR2I,                        \
+		&&OPCODE_ASSIGN_VECTOR3,                         \
+		&&OPCODE_ASSIGN_VECTOR3I,                        \
 		&&OPCODE_ASSIGN_TYPED_BUILTIN,                   \
 		&&OPCODE_ASSIGN_TYPED_ARRAY,                     \
 		&&OPCODE_ASSIGN_TYPED_DICTIONARY,                \
@@ -816,6 +828,78 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				// The code generator only fuses operators that return a boolean.
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_INCREMENT_INT) {
+				CHECK_SPACE(3);
+
+				GET_VARIANT_PTR(target, 0);
+				GET_VARIANT_PTR(amount, 1);
+
+				*VariantInternal::get_int(target) += *VariantInternal::get_int(amount);
+
+				ip += 3;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_INCREMENT_FLOAT) {
+				CHECK_SPACE(3);
+
+				GET_VARIANT_PTR(target, 0);
+				GET_VARIANT_PTR(amount, 1);
+
+				*VariantInternal::get_float(target) += *VariantInternal::get_float(amount);
+
+				ip += 3;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_DECREMENT_INT) {
+				CHECK_SPACE(3);
+
+				GET_VARIANT_PTR(target, 0);
+				GET_VARIANT_PTR(amount, 1);
+
+				*VariantInternal::get_int(target) -= *VariantInternal::get_int(amount);
+
+				ip += 3;
+			}
+			DISPATCH_OPCODE;
+
+			OPCODE(OPCODE_DECREMENT_FLOAT) {
+				CHECK_SPACE(3);
+
+				GET_VARIANT_PTR(target, 0);
+				GET_VARIANT_PTR(amount, 1);
+
+				*VariantInternal::get_float(target) -= *VariantInternal::get_float(amount);
+
+				ip += 3;
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_TYPE_TEST_BUILTIN) {
 				CHECK_SPACE(4);
 
@@ -1376,6 +1460,26 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			// Both sides are statically typed, so copy the payload without going through `Variant::operator=`.
+#define OPCODE_ASSIGN_UNBOXED(m_v_type, m_c_type)                                                        \
+	OPCODE(OPCODE_ASSIGN_##m_v_type) {                                                                   \
+		CHECK_SPACE(3);                                                                                  \
+		GET_VARIANT_PTR(dst, 0);                                                                         \
+		GET_VARIANT_PTR(src, 1);                                                                         \
+		VariantTypeChanger<m_c_type>::change(dst);                                                       \
+		*VariantGetInternalPtr<m_c_type>::get_ptr(dst) = *VariantGetInternalPtr<m_c_type>::get_ptr(src); \
+		ip += 3;                                                                                         \
+	}                                                                                                    \
+	DISPATCH_OPCODE
+
+			OPCODE_ASSIGN_UNBOXED(BOOL, bool);
+			OPCODE_ASSIGN_UNBOXED(INT, int64_t);
+			OPCODE_ASSIGN_UNBOXED(FLOAT, double);
+			OPCODE_ASSIGN_UNBOXED(VECTOR2, Vector2);
+			OPCODE_ASSIGN_UNBOXED(VECTOR2I, Vector2i);
+			OPCODE_ASSIGN_UNBOXED(VECTOR3, Vector3);
+			OPCODE_ASSIGN_UNBOXED(VECTOR3I, Vector3i);
+
 			OPCODE(OPCODE_ASSIGN_TYPED_BUILTIN) {
 				CHECK_SPACE(4);
 				GET_VARIANT_PTR(dst, 0);
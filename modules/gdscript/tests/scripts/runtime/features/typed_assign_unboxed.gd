@@ -0,0 +1,38 @@
+# Assignments between locals of the same plain built-in type skip the
+# generic Variant assignment. Check values and types survive stack reuse.
+
+func test():
+	if true:
+		var s := "text"
+		var o := RefCounted.new()
+		print(s, " ", o is RefCounted)
+
+	# These locals may reuse the stack slots of the block above.
+	var b := true
+	var i := 7
+	var f := 1.5
+	var v2 := Vector2(1, 2)
+	var v2i := Vector2i(3, 4)
+	var v3 := Vector3(5, 6, 7)
+	var v3i := Vector3i(8, 9, 10)
+
+	var b2: bool = b
+	var i2: int = i
+	var f2: float = f
+	var v2_2: Vector2 = v2
+	var v2i_2: Vector2i = v2i
+	var v3_2: Vector3 = v3
+	var v3i_2: Vector3i = v3i
+	print(b2, " ", i2, " ", f2, " ", v2_2, " ", v2i_2, " ", v3_2, " ", v3i_2)
+	print(typeof(b2) == TYPE_BOOL, typeof(i2) == TYPE_INT, typeof(f2) == TYPE_FLOAT)
+
+	# Copies are independent.
+	i2 = 1
+	v3_2.x = 0
+	print(i, " ", v3)
+
+	var total := 0
+	for n in 3:
+		var last: int = n
+		total += last
+	print(total)
@@ -0,0 +1,42 @@
+# Typed comparisons followed by a jump and in-place updates of typed locals
+# are fused into single instructions. Check they behave like the unfused ones.
+
+func count_range(n: int) -> int:
+	var total := 0
+	for i in range(n):
+		total += i
+	return total
+
+func test():
+	var i := 0
+	var f := 0.0
+	while i < 5:
+		i += 1
+		f += 0.5
+	print(i)
+	print(f)
+
+	while i > 0:
+		i -= 2
+		f -= 1.0
+	print(i)
+	print(f)
+
+	var step := 3
+	i += step
+	i += i
+	print(i)
+
+	if i >= 4 and f < 0.0:
+		print("both true")
+	if not (i == 4):
+		print("not four")
+	print("small" if i < 10 else "large")
+
+	print(count_range(5))
+	print(count_range(0))
+	print(count_range(-3))
+
+	var untyped = 1
+	untyped += 1.5
+	print(untyped)
@@ -0,0 +1,136 @@
+/**************************************************************************/
+/*  test_gdscript_benchmark.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#ifndef TEST_GDSCRIPT_BENCHMARK_H
+#define TEST_GDSCRIPT_BENCHMARK_H
+
+#include "modules/gdscript/gdscript.h"
+#include "modules/gdscript/gdscript_byte_codegen.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+struct BenchmarkScript {
+	const char *name;
+	const char *source;
+};
+
+// Hot loops like the ones in AI scripts: typed counters, typed math, conditions and member access.
+static const BenchmarkScript benchmark_scripts[] = {
+	{ "Typed int math in a range loop", R"(
+extends RefCounted
+
+func run(n: int) -> int:
+	var sum := 0
+	for i in range(n):
+		sum += i * 3
+		if sum > 1000000:
+			sum -= 1000000
+	return sum
+)" },
+	{ "Typed float math in a while loop", R"(
+extends RefCounted
+
+func run(n: int) -> int:
+	var x := 0.0
+	var i := 0
+	while i < n:
+		x += 0.5
+		if x > 100.0:
+			x -= 100.0
+		i += 1
+	return int(x)
+)" },
+	{ "Members and compound conditions", R"(
+extends RefCounted
+
+var speed := 2
+var limit := 1000
+
+func run(n: int) -> int:
+	var position := 0
+	var bounces := 0
+	for i in range(n):
+		position += speed
+		if position > limit and i > 10:
+			position -= limit
+			bounces += 1
+	return position + bounces
+)" },
+};
+
+// Returns loop iterations per second, or -1 if the script failed to run.
+static double run_benchmark_script(const BenchmarkScript &p_script, int p_iterations, Variant &r_result) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_script.source);
+	// A spurious `Condition "err" is true` message is printed (despite parsing being successful and returning `OK`).
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	if (error != OK) {
+		return -1.0;
+	}
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	r_result = ref_counted->call("run", p_iterations);
+	const uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+	return p_iterations * 1000000.0 / elapsed_usec;
+}
+
+// TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
+#ifdef TOOLS_ENABLED
+TEST_CASE_BENCHMARK("[Benchmark][Modules][GDScript] Loop iterations per second with and without superinstructions") {
+	const int iterations = 2000000;
+
+	for (const BenchmarkScript &script : benchmark_scripts) {
+		Variant plain_result;
+		GDScriptByteCodeGenerator::superinstructions_enabled = false;
+		const double plain_ops = run_benchmark_script(script, iterations, plain_result);
+
+		Variant fused_result;
+		GDScriptByteCodeGenerator::superinstructions_enabled = true;
+		const double fused_ops = run_benchmark_script(script, iterations, fused_result);
+
+		REQUIRE_MESSAGE(plain_ops > 0.0, "The benchmark script should compile.");
+		REQUIRE_MESSAGE(fused_ops > 0.0, "The benchmark script should compile.");
+		CHECK_MESSAGE(plain_result == fused_result, "Superinstructions should not change the result.");
+		MESSAGE(vformat("%s: %d ops/s before, %d ops/s after (x%.2f).", script.name, (int64_t)plain_ops, (int64_t)fused_ops, fused_ops / plain_ops));
+	}
+}
+#endif // TOOLS_ENABLED
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_BENCHMARK_H
@@ -102,6 +102,11 @@ class GodotBody2D : public GodotCollisionObject2D {
 	bool active = true;
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
+
+	// Motion computed by integrate_forces(), applied to the shapes by commit_integrate_forces().
+	Vector2 integration_motion;
+	bool integration_has_motion = false;
+
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
@@ -315,8 +320,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// Safe to run for several bodies at once. The commit functions update the space and the
+	// broadphase, so they must run serially afterwards.
 	void integrate_forces(real_t p_step);
+	void commit_integrate_forces();
 	void integrate_velocities(real_t p_step);
+	void commit_integrate_velocities();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
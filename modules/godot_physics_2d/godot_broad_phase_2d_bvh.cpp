@@ -31,6 +31,8 @@
 #include "godot_broad_phase_2d_bvh.h"
 #include "godot_collision_object_2d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 GodotBroadPhase2D::ID GodotBroadPhase2DBVH::create(GodotCollisionObject2D *p_object, int p_subindex, const Rect2 &p_aabb, bool p_static) {
 	uint32_t tree_id = p_static ? TREE_STATIC : TREE_DYNAMIC;
 	uint32_t tree_collision_mask = p_static ? TREE_FLAG_DYNAMIC : (TREE_FLAG_STATIC | TREE_FLAG_DYNAMIC);
@@ -99,6 +101,11 @@ void GodotBroadPhase2DBVH::_unpair_callback(void *self, uint32_t p_A, GodotColli
 	bpo->unpair_callback(p_object_A, subindex_A, p_object_B, subindex_B, pairdata, bpo->unpair_userdata);
 }
 
+void GodotBroadPhase2DBVH::_parallel_for(void (*p_function)(void *, uint32_t), void *p_userdata, uint32_t p_count) {
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(p_function, p_userdata, p_count, -1, true, SNAME("BVHPairing"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 void GodotBroadPhase2DBVH::set_pair_callback(PairCallback p_pair_callback, void *p_userdata) {
 	pair_callback = p_pair_callback;
 	pair_userdata = p_userdata;
@@ -120,4 +127,5 @@ GodotBroadPhase2D *GodotBroadPhase2DBVH::_create() {
 GodotBroadPhase2DBVH::GodotBroadPhase2DBVH() {
 	bvh.set_pair_callback(_pair_callback, this);
 	bvh.set_unpair_callback(_unpair_callback, this);
+	bvh.params_set_parallel_pairing(_parallel_for);
 }
@@ -69,6 +69,7 @@ class GodotBroadPhase2DBVH : public GodotBroadPhase2D {
 
 	static void *_pair_callback(void *, uint32_t, GodotCollisionObject2D *, int, uint32_t, GodotCollisionObject2D *, int);
 	static void _unpair_callback(void *, uint32_t, GodotCollisionObject2D *, int, uint32_t, GodotCollisionObject2D *, int, void *);
+	static void _parallel_for(void (*p_function)(void *, uint32_t), void *p_userdata, uint32_t p_count);
 
 	PairCallback pair_callback = nullptr;
 	void *pair_userdata = nullptr;
@@ -78,6 +78,23 @@ void GodotStep2D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
+void GodotStep2D::_gather_active_bodies(const SelfList<GodotBody2D>::List *p_body_list) {
+	active_bodies.clear();
+	const SelfList<GodotBody2D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+}
+
+void GodotStep2D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep2D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
 void GodotStep2D::_pre_solve_island(LocalVector<GodotConstraint2D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
@@ -143,13 +160,18 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	// Same as in 3D: bodies are integrated in parallel, and whatever touches the space or the
+	// broadphase is committed serially in active list order. Islands don't share any dynamic
+	// body, so solving them in parallel doesn't depend on the task split either. The result is
+	// the same for any number of threads.
+	_gather_active_bodies(body_list);
+	int active_count = active_bodies.size();
 
-	const SelfList<GodotBody2D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics2DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (GodotBody2D *body : active_bodies) {
+		body->commit_integrate_forces();
 	}
 
 	p_space->set_active_objects(active_count);
@@ -193,7 +215,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	const SelfList<GodotBody2D> *b = body_list->first();
 
 	uint32_t body_island_count = 0;
 
@@ -241,7 +263,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -272,11 +294,15 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+	// Bodies woken up while solving are part of the active list now.
+	_gather_active_bodies(body_list);
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics2DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Kinematic bodies may deactivate here, which removes them from the active list.
+	for (GodotBody2D *body : active_bodies) {
+		body->commit_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -292,6 +318,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	}
 
 	all_constraints.clear();
+	active_bodies.clear();
 
 	p_space->unlock();
 	_step++;
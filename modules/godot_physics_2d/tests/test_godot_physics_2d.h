@@ -0,0 +1,207 @@
+/**************************************************************************/
+/*  test_godot_physics_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_PHYSICS_2D_H
+#define TEST_GODOT_PHYSICS_2D_H
+
+#include "../godot_space_2d.h"
+
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "servers/physics_server_2d.h"
+
+#include "tests/servers/physics_test_utils.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics2D {
+
+// The tests check the behavior of Godot Physics, so they return early when another 2D physics server is in use.
+static bool is_godot_physics() {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	RID space = ps->space_create();
+	const bool godot_physics = Object::cast_to<GodotPhysicsDirectSpaceState2D>(ps->space_get_direct_state(space)) != nullptr;
+	ps->free(space);
+	return godot_physics;
+}
+
+// Piles of boxes on a floor, centered on x = 0. Each pile is its own island.
+static void build_piles(RID p_space, RID p_floor_shape, RID p_box_shape, int p_pile_count, LocalVector<RID> &r_bodies) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	RID floor = ps->body_create();
+	ps->body_set_mode(floor, PhysicsServer2D::BODY_MODE_STATIC);
+	ps->body_add_shape(floor, p_floor_shape);
+	ps->body_set_state(floor, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0, Vector2(0, 10)));
+	ps->body_set_space(floor, p_space);
+	r_bodies.push_back(floor);
+
+	for (int pile = 0; pile < p_pile_count; pile++) {
+		for (int i = 0; i < 10; i++) {
+			RID box = ps->body_create();
+			ps->body_set_mode(box, PhysicsServer2D::BODY_MODE_RIGID);
+			ps->body_add_shape(box, p_box_shape);
+			// Slightly staggered, so the piles topple and bodies keep interacting.
+			ps->body_set_state(box, PhysicsServer2D::BODY_STATE_TRANSFORM, Transform2D(0.1 * i, Vector2(pile * 40 - p_pile_count * 20 + (i % 3) * 2, 5 - i * 11)));
+			ps->body_set_space(box, p_space);
+			r_bodies.push_back(box);
+		}
+	}
+}
+
+static void free_space(RID p_space, const LocalVector<RID> &p_bodies) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	for (const RID &body : p_bodies) {
+		ps->free(body);
+	}
+	ps->space_set_active(p_space, false);
+	ps->free(p_space);
+}
+
+// Simulates the piles in a new space, and returns the state of its bodies after each step. With
+// p_busy, another space full of bodies is created first and stepped along, so the RIDs, the
+// memory of the bodies and the load on the worker threads all differ.
+static void simulate_piles(RID p_floor_shape, RID p_box_shape, bool p_busy, int p_steps, LocalVector<uint32_t> &r_hashes) {
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	RID busy_space;
+	LocalVector<RID> busy_bodies;
+	if (p_busy) {
+		busy_space = ps->space_create();
+		ps->space_set_active(busy_space, true);
+		for (int i = 0; i < 3; i++) {
+			build_piles(busy_space, p_floor_shape, p_box_shape, 8, busy_bodies);
+		}
+	}
+
+	RID space = ps->space_create();
+	ps->space_set_active(space, true);
+	LocalVector<RID> bodies;
+	build_piles(space, p_floor_shape, p_box_shape, 8, bodies);
+
+	for (int i = 0; i < p_steps; i++) {
+		ps->step(1.0 / 60.0);
+		r_hashes.push_back(PhysicsTestUtils::hash_body_states<PhysicsServer2D>(bodies));
+	}
+
+	free_space(space, bodies);
+	if (p_busy) {
+		free_space(busy_space, busy_bodies);
+	}
+}
+
+TEST_CASE("[SceneTree][GodotPhysics2D] Stepping is deterministic") {
+	if (!is_godot_physics()) {
+		return;
+	}
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+
+	RID floor_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(floor_shape, Vector2(400, 10));
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(5, 5));
+
+	// Bodies are integrated and islands solved on worker threads, which mustn't change the outcome.
+	// The same piles are simulated twice, one after the other, and compared bit for bit after every
+	// step, positions and velocities included.
+	const int steps = 180;
+	LocalVector<uint32_t> hashes[2];
+	simulate_piles(floor_shape, box_shape, false, steps, hashes[0]);
+	simulate_piles(floor_shape, box_shape, true, steps, hashes[1]);
+
+	REQUIRE(hashes[0].size() == steps);
+	REQUIRE(hashes[1].size() == steps);
+	int first_mismatch = -1;
+	for (int i = 0; i < steps; i++) {
+		if (hashes[0][i] != hashes[1][i]) {
+			first_mismatch = i;
+			break;
+		}
+	}
+	CHECK_MESSAGE(first_mismatch == -1, vformat("The simulations diverged at step %d.", first_mismatch));
+
+	// Sanity check that the piles actually moved.
+	CHECK(hashes[0][0] != hashes[0][steps - 1]);
+
+	ps->free(box_shape);
+	ps->free(floor_shape);
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][SceneTree][GodotPhysics2D] Step time with 1 to 16 worker threads") {
+	if (!is_godot_physics()) {
+		return;
+	}
+	PhysicsServer2D *ps = PhysicsServer2D::get_singleton();
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+
+	const int pile_count = 64;
+	const int steps = 120;
+	RID floor_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(floor_shape, Vector2(pile_count * 20 + 40, 10));
+	RID box_shape = ps->rectangle_shape_create();
+	ps->shape_set_data(box_shape, Vector2(5, 5));
+
+	// The pool is restarted with each thread count, the results must stay the same.
+	const bool work_stealing = pool->is_work_stealing_enabled();
+	uint32_t first_hash = 0;
+	for (int threads = 1; threads <= 16; threads *= 2) {
+		pool->finish();
+		pool->init(threads, 0.3, work_stealing);
+
+		RID space = ps->space_create();
+		ps->space_set_active(space, true);
+		LocalVector<RID> bodies;
+		build_piles(space, floor_shape, box_shape, pile_count, bodies);
+
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < steps; i++) {
+			ps->step(1.0 / 60.0);
+		}
+		const uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+		const uint32_t hash = PhysicsTestUtils::hash_body_states<PhysicsServer2D>(bodies);
+		if (threads == 1) {
+			first_hash = hash;
+		}
+		CHECK(hash == first_hash);
+		MESSAGE(vformat("%d threads: %.3f ms per step for %d bodies.", threads, elapsed_usec / 1000.0 / steps, bodies.size()));
+
+		free_space(space, bodies);
+	}
+
+	pool->finish();
+	pool->init(-1, 0.3, work_stealing);
+
+	ps->free(box_shape);
+	ps->free(floor_shape);
+}
+
+} // namespace TestGodotPhysics2D
+
+#endif // TEST_GODOT_PHYSICS_2D_H
@@ -228,7 +228,73 @@ void GodotArea3D::set_monitorable(bool p_monitorable) {
 	_shapes_changed();
 }
 
+// Moves the pending events to r_events, five values per event in the order of the monitor callback's arguments.
+void GodotArea3D::_pop_monitor_events(HashMap<BodyKey, BodyState, BodyKey> &r_monitored, PackedInt64Array &r_events) {
+	r_events.resize(r_monitored.size() * 5);
+	int64_t *w = r_events.ptrw();
+	int count = 0;
+
+	for (const KeyValue<BodyKey, BodyState> &E : r_monitored) {
+		if (E.value.state == 0) { // Nothing happened
+			continue;
+		}
+
+		w[count++] = E.value.state > 0 ? PhysicsServer3D::AREA_BODY_ADDED : PhysicsServer3D::AREA_BODY_REMOVED;
+		w[count++] = E.key.rid.get_id();
+		w[count++] = E.key.instance_id;
+		w[count++] = E.key.body_shape;
+		w[count++] = E.key.area_shape;
+	}
+
+	r_events.resize(count);
+	r_monitored.clear();
+}
+
+void GodotArea3D::_call_batched_queries() {
+	PackedInt64Array body_events;
+	PackedInt64Array area_events;
+
+	if (!monitor_callback.is_null() && !monitored_bodies.is_empty()) {
+		if (monitor_callback.is_valid()) {
+			_pop_monitor_events(monitored_bodies, body_events);
+		} else {
+			monitored_bodies.clear();
+			monitor_callback = Callable();
+		}
+	}
+
+	if (!area_monitor_callback.is_null() && !monitored_areas.is_empty()) {
+		if (area_monitor_callback.is_valid()) {
+			_pop_monitor_events(monitored_areas, area_events);
+		} else {
+			monitored_areas.clear();
+			area_monitor_callback = Callable();
+		}
+	}
+
+	if (body_events.is_empty() && area_events.is_empty()) {
+		return;
+	}
+
+	Variant res[2] = { body_events, area_events };
+	const Variant *resptr[2] = { &res[0], &res[1] };
+
+	Callable::CallError ce;
+	Variant ret;
+	monitor_batch_callback.callp(resptr, 2, ret, ce);
+
+	if (ce.error != Callable::CallError::CALL_OK) {
+		ERR_PRINT_ONCE("Error calling monitor batch callback method " + Variant::get_callable_error_text(monitor_batch_callback, resptr, 2, ce));
+	}
+}
+
 void GodotArea3D::call_queries() {
+	if (monitor_batch_callback.is_valid()) {
+		// One call with all the events of this step.
+		_call_batched_queries();
+		return;
+	}
+
 	if (!monitor_callback.is_null() && !monitored_bodies.is_empty()) {
 		if (monitor_callback.is_valid()) {
 			Variant res[5];
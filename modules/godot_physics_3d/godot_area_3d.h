@@ -61,6 +61,7 @@ class GodotArea3D : public GodotCollisionObject3D {
 
 	Callable monitor_callback;
 	Callable area_monitor_callback;
+	Callable monitor_batch_callback;
 
 	SelfList<GodotArea3D> monitor_query_list;
 	SelfList<GodotArea3D> moved_list;
@@ -102,6 +103,8 @@ class GodotArea3D : public GodotCollisionObject3D {
 
 	virtual void _shapes_changed() override;
 	void _queue_monitor_update();
+	void _pop_monitor_events(HashMap<BodyKey, BodyState, BodyKey> &r_monitored, PackedInt64Array &r_events);
+	void _call_batched_queries();
 
 	void _set_space_override_mode(PhysicsServer3D::AreaSpaceOverrideMode &r_mode, PhysicsServer3D::AreaSpaceOverrideMode p_new_mode);
 
@@ -112,6 +115,8 @@ public:
 	void set_area_monitor_callback(const Callable &p_callback);
 	_FORCE_INLINE_ bool has_area_monitor_callback() const { return area_monitor_callback.is_valid(); }
 
+	void set_monitor_batch_callback(const Callable &p_callback) { monitor_batch_callback = p_callback; }
+
 	_FORCE_INLINE_ void add_body_to_query(GodotBody3D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
 	_FORCE_INLINE_ void remove_body_from_query(GodotBody3D *p_body, uint32_t p_body_shape, uint32_t p_area_shape);
 
@@ -32,9 +32,24 @@
 
 #include "godot_collision_solver_3d.h"
 
+bool GodotOverlapCache3D::test(const GodotCollisionObject3D *p_A, int p_shape_A, const GodotCollisionObject3D *p_B, int p_shape_B) {
+	if (valid && shapes_version_A == p_A->get_shapes_version() && shapes_version_B == p_B->get_shapes_version() && xform_A == p_A->get_transform() && xform_B == p_B->get_transform()) {
+		return overlapping;
+	}
+
+	xform_A = p_A->get_transform();
+	xform_B = p_B->get_transform();
+	shapes_version_A = p_A->get_shapes_version();
+	shapes_version_B = p_B->get_shapes_version();
+	valid = true;
+
+	overlapping = GodotCollisionSolver3D::solve_static(p_A->get_shape(p_shape_A), xform_A * p_A->get_shape_transform(p_shape_A), p_B->get_shape(p_shape_B), xform_B * p_B->get_shape_transform(p_shape_B), nullptr, nullptr);
+	return overlapping;
+}
+
 bool GodotAreaPair3D::setup(real_t p_step) {
 	bool result = false;
-	if (area->collides_with(body) && GodotCollisionSolver3D::solve_static(body->get_shape(body_shape), body->get_transform() * body->get_shape_transform(body_shape), area->get_shape(area_shape), area->get_transform() * area->get_shape_transform(area_shape), nullptr, this)) {
+	if (area->collides_with(body) && overlap.test(body, body_shape, area, area_shape)) {
 		result = true;
 	}
 
@@ -92,6 +107,10 @@ void GodotAreaPair3D::solve(real_t p_step) {
 	// Nothing to do.
 }
 
+GodotConstraint3D::OrderKey GodotAreaPair3D::get_order_key() const {
+	return make_pair_order_key(body->get_self(), body_shape, area->get_self(), area_shape);
+}
+
 GodotAreaPair3D::GodotAreaPair3D(GodotBody3D *p_body, int p_body_shape, GodotArea3D *p_area, int p_area_shape) {
 	body = p_body;
 	area = p_area;
@@ -123,7 +142,7 @@ GodotAreaPair3D::~GodotAreaPair3D() {
 bool GodotArea2Pair3D::setup(real_t p_step) {
 	bool result_a = area_a->collides_with(area_b);
 	bool result_b = area_b->collides_with(area_a);
-	if ((result_a || result_b) && !GodotCollisionSolver3D::solve_static(area_a->get_shape(shape_a), area_a->get_transform() * area_a->get_shape_transform(shape_a), area_b->get_shape(shape_b), area_b->get_transform() * area_b->get_shape_transform(shape_b), nullptr, this)) {
+	if ((result_a || result_b) && !overlap.test(area_a, shape_a, area_b, shape_b)) {
 		result_a = false;
 		result_b = false;
 	}
@@ -175,6 +194,10 @@ void GodotArea2Pair3D::solve(real_t p_step) {
 	// Nothing to do.
 }
 
+GodotConstraint3D::OrderKey GodotArea2Pair3D::get_order_key() const {
+	return make_pair_order_key(area_a->get_self(), shape_a, area_b->get_self(), shape_b);
+}
+
 GodotArea2Pair3D::GodotArea2Pair3D(GodotArea3D *p_area_a, int p_shape_a, GodotArea3D *p_area_b, int p_shape_b) {
 	area_a = p_area_a;
 	area_b = p_area_b;
@@ -270,6 +293,10 @@ void GodotAreaSoftBodyPair3D::solve(real_t p_step) {
 	// Nothing to do.
 }
 
+GodotConstraint3D::OrderKey GodotAreaSoftBodyPair3D::get_order_key() const {
+	return make_pair_order_key(soft_body->get_self(), soft_body_shape, area->get_self(), area_shape);
+}
+
 GodotAreaSoftBodyPair3D::GodotAreaSoftBodyPair3D(GodotSoftBody3D *p_soft_body, int p_soft_body_shape, GodotArea3D *p_area, int p_area_shape) {
 	soft_body = p_soft_body;
 	area = p_area;
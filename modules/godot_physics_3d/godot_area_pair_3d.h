@@ -36,11 +36,26 @@
 #include "godot_constraint_3d.h"
 #include "godot_soft_body_3d.h"
 
+// Result of the last overlap test between two shapes. Moved areas and active bodies get their
+// pairs set up every step, but the test only needs to run again when one of the sides actually
+// moved or had its shapes changed.
+struct GodotOverlapCache3D {
+	Transform3D xform_A;
+	Transform3D xform_B;
+	uint32_t shapes_version_A = 0;
+	uint32_t shapes_version_B = 0;
+	bool valid = false;
+	bool overlapping = false;
+
+	bool test(const GodotCollisionObject3D *p_A, int p_shape_A, const GodotCollisionObject3D *p_B, int p_shape_B);
+};
+
 class GodotAreaPair3D : public GodotConstraint3D {
 	GodotBody3D *body = nullptr;
 	GodotArea3D *area = nullptr;
 	int body_shape;
 	int area_shape;
+	GodotOverlapCache3D overlap;
 	bool colliding = false;
 	bool process_collision = false;
 	bool has_space_override = false;
@@ -51,6 +66,8 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override;
+
 	GodotAreaPair3D(GodotBody3D *p_body, int p_body_shape, GodotArea3D *p_area, int p_area_shape);
 	~GodotAreaPair3D();
 };
@@ -60,6 +77,7 @@ class GodotArea2Pair3D : public GodotConstraint3D {
 	GodotArea3D *area_b = nullptr;
 	int shape_a;
 	int shape_b;
+	GodotOverlapCache3D overlap;
 	bool colliding_a = false;
 	bool colliding_b = false;
 	bool process_collision_a = false;
@@ -72,6 +90,8 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override;
+
 	GodotArea2Pair3D(GodotArea3D *p_area_a, int p_shape_a, GodotArea3D *p_area_b, int p_shape_b);
 	~GodotArea2Pair3D();
 };
@@ -91,6 +111,8 @@ public:
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override;
+
 	GodotAreaSoftBodyPair3D(GodotSoftBody3D *p_sof_body, int p_soft_body_shape, GodotArea3D *p_area, int p_area_shape);
 	~GodotAreaSoftBodyPair3D();
 };
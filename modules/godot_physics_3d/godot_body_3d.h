@@ -108,6 +108,10 @@ class GodotBody3D : public GodotCollisionObject3D {
 	bool can_sleep = true;
 	bool first_time_kinematic = false;
 
+	// Motion computed by integrate_forces(), applied to the shapes by commit_integrate_forces().
+	Vector3 integration_motion;
+	bool integration_has_motion = false;
+
 	void _mass_properties_changed();
 	virtual void _shapes_changed() override;
 	Transform3D new_transform;
@@ -316,8 +320,13 @@ public:
 	void set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool lock);
 	bool is_axis_locked(PhysicsServer3D::BodyAxis p_axis) const;
 
+	// integrate_forces() and integrate_velocities() only modify this body, so they can run
+	// for several bodies in parallel. The matching commit functions update the space and
+	// the broadphase, and must be called serially afterwards.
 	void integrate_forces(real_t p_step);
+	void commit_integrate_forces();
 	void integrate_velocities(real_t p_step);
+	void commit_integrate_velocities();
 
 	_FORCE_INLINE_ Vector3 get_velocity_in_local_point(const Vector3 &rel_pos) const {
 		return linear_velocity + angular_velocity.cross(rel_pos - center_of_mass);
@@ -36,6 +36,14 @@
 #define MIN_VELOCITY 0.0001
 #define MAX_BIAS_ROTATION (Math_PI / 8)
 
+// Squared area of the quadrilateral, for whichever order of the points gives the largest one (times 4).
+static _FORCE_INLINE_ real_t _get_quad_area_squared(const Vector3 *p_points) {
+	real_t area_0 = (p_points[0] - p_points[1]).cross(p_points[2] - p_points[3]).length_squared();
+	real_t area_1 = (p_points[0] - p_points[2]).cross(p_points[1] - p_points[3]).length_squared();
+	real_t area_2 = (p_points[0] - p_points[3]).cross(p_points[1] - p_points[2]).length_squared();
+	return MAX(area_0, MAX(area_1, area_2));
+}
+
 void GodotBodyPair3D::_contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata) {
 	GodotBodyPair3D *pair = static_cast<GodotBodyPair3D *>(p_userdata);
 	pair->contact_added_callback(p_point_A, p_index_A, p_point_B, p_index_B, normal);
@@ -57,58 +65,92 @@ void GodotBodyPair3D::contact_added_callback(const Vector3 &p_point_A, int p_ind
 	contact.normal = (p_point_A - p_point_B).normalized();
 	contact.used = true;
 
-	// Attempt to determine if the contact will be reused.
+	// Attempt to determine if the contact will be reused, matching it with the closest contact
+	// from the previous step that wasn't claimed by another one yet.
 	real_t contact_recycle_radius = space->get_contact_recycle_radius();
+	real_t contact_recycle_radius2 = contact_recycle_radius * contact_recycle_radius;
 
+	int recycled = -1;
+	real_t recycled_distance2 = 0.0;
 	for (int i = 0; i < contact_count; i++) {
-		Contact &c = contacts[i];
-		if (c.local_A.distance_squared_to(local_A) < (contact_recycle_radius * contact_recycle_radius) &&
-				c.local_B.distance_squared_to(local_B) < (contact_recycle_radius * contact_recycle_radius)) {
-			contact.acc_normal_impulse = c.acc_normal_impulse;
-			contact.acc_bias_impulse = c.acc_bias_impulse;
-			contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
-			contact.acc_tangent_impulse = c.acc_tangent_impulse;
-			c = contact;
-			return;
+		const Contact &c = contacts[i];
+		if (c.used) {
+			continue;
+		}
+		real_t distance_A2 = c.local_A.distance_squared_to(local_A);
+		real_t distance_B2 = c.local_B.distance_squared_to(local_B);
+		if (distance_A2 < contact_recycle_radius2 && distance_B2 < contact_recycle_radius2) {
+			if (recycled == -1 || distance_A2 + distance_B2 < recycled_distance2) {
+				recycled = i;
+				recycled_distance2 = distance_A2 + distance_B2;
+			}
 		}
 	}
 
+	if (recycled != -1) {
+		// Warm start with the impulses from the previous step. The friction impulse is kept in the
+		// tangent plane of the new normal, so it doesn't push along the normal when it changes.
+		Contact &c = contacts[recycled];
+		contact.acc_normal_impulse = c.acc_normal_impulse;
+		contact.acc_bias_impulse = c.acc_bias_impulse;
+		contact.acc_bias_impulse_center_of_mass = c.acc_bias_impulse_center_of_mass;
+		contact.acc_tangent_impulse = c.acc_tangent_impulse - contact.normal * contact.normal.dot(c.acc_tangent_impulse);
+		c = contact;
+		return;
+	}
+
 	// Figure out if the contact amount must be reduced to fit the new contact.
 	if (new_index == MAX_CONTACTS) {
-		// Remove the contact with the minimum depth.
-
+		// Always keep the deepest point, then drop whichever point leaves the largest contact area.
+		// This keeps the manifold spread out over the contact patch, which is what keeps stacks stable.
 		const Basis &basis_A = A->get_transform().basis;
 		const Basis &basis_B = B->get_transform().basis;
 
-		int least_deep = -1;
-		real_t min_depth;
-
-		// Start with depth for new contact.
-		{
-			Vector3 global_A = basis_A.xform(contact.local_A);
-			Vector3 global_B = basis_B.xform(contact.local_B) + offset_B;
-
-			Vector3 axis = global_A - global_B;
-			min_depth = axis.dot(contact.normal);
-		}
+		Vector3 points[MAX_CONTACTS + 1];
+		int deepest = 0;
+		real_t max_depth = 0.0;
 
-		for (int i = 0; i < contact_count; i++) {
-			const Contact &c = contacts[i];
+		for (int i = 0; i <= MAX_CONTACTS; i++) {
+			const Contact &c = (i < MAX_CONTACTS) ? contacts[i] : contact;
 			Vector3 global_A = basis_A.xform(c.local_A);
 			Vector3 global_B = basis_B.xform(c.local_B) + offset_B;
 
 			Vector3 axis = global_A - global_B;
 			real_t depth = axis.dot(c.normal);
 
-			if (depth < min_depth) {
-				min_depth = depth;
-				least_deep = i;
+			points[i] = global_A;
+			if (i == 0 || depth > max_depth) {
+				deepest = i;
+				max_depth = depth;
 			}
 		}
 
-		if (least_deep > -1) {
-			// Replace the least deep contact by the new one.
-			contacts[least_deep] = contact;
+		// Going backwards prefers dropping the new contact on ties, so the manifold doesn't churn.
+		int drop = -1;
+		real_t max_area = 0.0;
+		for (int i = MAX_CONTACTS; i >= 0; i--) {
+			if (i == deepest) {
+				continue;
+			}
+
+			Vector3 quad[MAX_CONTACTS];
+			int quad_count = 0;
+			for (int j = 0; j <= MAX_CONTACTS; j++) {
+				if (j != i) {
+					quad[quad_count++] = points[j];
+				}
+			}
+
+			real_t area = _get_quad_area_squared(quad);
+			if (drop == -1 || area > max_area) {
+				drop = i;
+				max_area = area;
+			}
+		}
+
+		if (drop < MAX_CONTACTS) {
+			// Replace the dropped contact by the new one.
+			contacts[drop] = contact;
 		}
 
 		return;
@@ -130,8 +172,8 @@ void GodotBodyPair3D::validate_contacts() {
 		Contact &c = contacts[i];
 
 		bool erase = false;
-		if (!c.used) {
-			// Was left behind in previous frame.
+		if (!c.used || c.speculative) {
+			// Was left behind in previous frame, or was only speculative (added again when still needed).
 			erase = true;
 		} else {
 			c.used = false;
@@ -159,93 +201,99 @@ void GodotBodyPair3D::validate_contacts() {
 	}
 }
 
-// `_test_ccd` prevents tunneling by slowing down a high velocity body that is about to collide so
-// that next frame it will be at an appropriate location to collide (i.e. slight overlap).
-// WARNING: The way velocity is adjusted down to cause a collision means the momentum will be
-// weaker than it should for a bounce!
-// Process: Only proceed if body A's motion is high relative to its size.
-// Cast forward along motion vector to see if A is going to enter/pass B's collider next frame, only proceed if it does.
-// Adjust the velocity of A down so that it will just slightly intersect the collider instead of blowing right past it.
-bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
-	GodotShape3D *shape_A_ptr = p_A->get_shape(p_shape_A);
-
-	Vector3 motion = p_A->get_linear_velocity() * p_step;
-	real_t mlen = motion.length();
-	if (mlen < CMP_EPSILON) {
+static real_t _get_shape_radius(const GodotShape3D *p_shape) {
+	const AABB &aabb = p_shape->get_aabb();
+	return aabb.position.abs().max(aabb.get_end().abs()).length();
+}
+
+// Checks whether the contacts from the last narrow phase can be kept, because the shapes moved
+// less than the space's contact reuse threshold relative to each other since then.
+// The displacement of the smaller shape's points is estimated from the change in translation,
+// plus the change in rotation scaled by the shape's radius.
+// The relative transforms are only computed when there are contacts to check, r_xform_computed
+// tells whether they were.
+bool GodotBodyPair3D::_can_reuse_manifold(const GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B, Transform3D &r_xform, Transform3D &r_xform_inv, bool &r_xform_computed) const {
+	r_xform_computed = false;
+
+	real_t threshold = space->get_contact_reuse_threshold();
+	if (threshold <= 0.0 || !manifold_valid || contact_count == 0) {
 		return false;
 	}
 
-	Vector3 mnormal = motion / mlen;
+	r_xform = p_xform_A.affine_inverse() * p_xform_B;
+	r_xform_inv = r_xform.affine_inverse();
+	r_xform_computed = true;
 
-	real_t min = 0.0, max = 0.0;
-	shape_A_ptr->project_range(mnormal, p_xform_A, min, max);
+	real_t rotation_change = 0.0;
+	for (int i = 0; i < 3; i++) {
+		rotation_change = MAX(rotation_change, (r_xform.basis.get_column(i) - manifold_xform.basis.get_column(i)).length());
+	}
+
+	real_t motion_B = r_xform.origin.distance_to(manifold_xform.origin) + rotation_change * _get_shape_radius(p_shape_B);
+	real_t motion_A = r_xform_inv.origin.distance_to(manifold_xform_inv.origin) + rotation_change * _get_shape_radius(p_shape_A);
+
+	return MIN(motion_A, motion_B) <= threshold;
+}
 
-	// Did it move enough in this direction to even attempt raycast?
-	// Let's say it should move more than 1/3 the size of the object in that axis.
-	bool fast_object = mlen > (max - min) * 0.3;
-	if (!fast_object) {
-		return false; // moving slow enough that there's no chance of tunneling.
+// Continuous collision detection with a speculative contact. Bodies with CCD enabled have their
+// broadphase AABB swept along their motion, so pairs that may collide during the next step are
+// already paired before their shapes touch. For those, the closest points between the shapes are
+// added as a contact that lets the bodies approach each other by the gap between them, but not
+// any further. Then the regular solver stops them at the surface instead of letting them tunnel
+// through, rotation included, with no separate sweep or raycast.
+bool GodotBodyPair3D::_add_speculative_contact(real_t p_step, const GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B) {
+	const Vector3 relative_motion = (A->get_linear_velocity() - B->get_linear_velocity()) * p_step;
+
+	// The solver only handles a concave shape (or world boundary) as the second one.
+	bool swap = p_shape_A->is_concave() || p_shape_A->get_type() == PhysicsServer3D::SHAPE_WORLD_BOUNDARY;
+	if (swap && (p_shape_B->is_concave() || p_shape_B->get_type() == PhysicsServer3D::SHAPE_WORLD_BOUNDARY)) {
+		return false;
 	}
 
-	// A is moving fast enough that tunneling might occur. See if it's really about to collide.
-
-	// Roughly predict body B's position in the next frame (ignoring collisions).
-	Transform3D predicted_xform_B = p_xform_B.translated(p_B->get_linear_velocity() * p_step);
-
-	// Support points are the farthest forward points on A in the direction of the motion vector.
-	// i.e. the candidate points of which one should hit B first if any collision does occur.
-	static const int max_supports = 16;
-	Vector3 supports_A[max_supports];
-	int support_count_A;
-	GodotShape3D::FeatureType support_type_A;
-	// Convert mnormal into body A's local xform because get_supports requires (and returns) local coordinates.
-	shape_A_ptr->get_supports(p_xform_A.basis.xform_inv(mnormal).normalized(), max_supports, supports_A, support_count_A, support_type_A);
-
-	// Cast a segment from each support point of A in the motion direction.
-	int segment_support_idx = -1;
-	float segment_hit_length = FLT_MAX;
-	Vector3 segment_hit_local;
-	for (int i = 0; i < support_count_A; i++) {
-		supports_A[i] = p_xform_A.xform(supports_A[i]);
-
-		Vector3 from = supports_A[i];
-		Vector3 to = from + motion;
-
-		Transform3D from_inv = predicted_xform_B.affine_inverse();
-
-		// Back up 10% of the per-frame motion behind the support point and use that as the beginning of our cast.
-		// At high speeds, this may mean we're actually casting from well behind the body instead of inside it, which is odd.
-		// But it still works out.
-		Vector3 local_from = from_inv.xform(from - motion * 0.1);
-		Vector3 local_to = from_inv.xform(to);
-
-		Vector3 rpos, rnorm;
-		int fi = -1;
-		if (p_B->get_shape(p_shape_B)->intersect_segment(local_from, local_to, rpos, rnorm, fi, true)) {
-			float hit_length = local_from.distance_to(rpos);
-			if (hit_length < segment_hit_length) {
-				segment_support_idx = i;
-				segment_hit_length = hit_length;
-				segment_hit_local = rpos;
-			}
-		}
+	const GodotShape3D *convex_shape = swap ? p_shape_B : p_shape_A;
+	const Transform3D &convex_xform = swap ? p_xform_B : p_xform_A;
+	AABB swept_aabb = convex_xform.xform(convex_shape->get_aabb());
+	swept_aabb.merge_with(AABB(swept_aabb.position + (swap ? -relative_motion : relative_motion), swept_aabb.size));
+
+	Vector3 point_A;
+	Vector3 point_B;
+	bool separated;
+	if (swap) {
+		separated = GodotCollisionSolver3D::solve_distance(p_shape_B, p_xform_B, p_shape_A, p_xform_A, point_B, point_A, swept_aabb);
+	} else {
+		separated = GodotCollisionSolver3D::solve_distance(p_shape_A, p_xform_A, p_shape_B, p_xform_B, point_A, point_B, swept_aabb);
+	}
+
+	if (!separated) {
+		return false;
 	}
 
-	if (segment_support_idx == -1) {
-		// There was no hit. Since the segment is the length of per-frame motion, this means the bodies will not
-		// actually collide yet on next frame. We'll probably check again next frame once they're closer.
+	Vector3 gap = point_B - point_A;
+	real_t distance = gap.length();
+	if (distance < CMP_EPSILON) {
 		return false;
 	}
 
-	Vector3 hitpos = predicted_xform_B.xform(segment_hit_local);
+	Vector3 normal = gap / distance;
 
-	real_t newlen = hitpos.distance_to(supports_A[segment_support_idx]);
-	// Adding 1% of body length to the distance between collision and support point
-	// should cause body A's support point to arrive just within B's collider next frame.
-	newlen += (max - min) * 0.01;
-	// FIXME: This doesn't always work well when colliding with a triangle face of a trimesh shape.
+	// Only needed if the closest points can meet during this step.
+	Vector3 velocity_A = A->get_linear_velocity() + A->get_angular_velocity().cross(point_A - A->get_center_of_mass());
+	Vector3 velocity_B = B->get_linear_velocity() + B->get_angular_velocity().cross(point_B - offset_B - B->get_center_of_mass());
+	if ((velocity_B - velocity_A).dot(normal) * p_step + distance > 0.0) {
+		return false;
+	}
 
-	p_A->set_linear_velocity((mnormal * newlen) / p_step);
+	// The shapes don't touch, so the contacts kept from the previous step are stale. They must not be
+	// solved along with the speculative one.
+	Contact &contact = contacts[0];
+	contact_count = 1;
+
+	contact = Contact();
+	contact.local_A = A->get_inv_transform().basis.xform(point_A);
+	contact.local_B = B->get_inv_transform().basis.xform(point_B - offset_B);
+	contact.normal = normal;
+	contact.used = true;
+	contact.speculative = true;
 
 	return true;
 }
@@ -259,10 +307,9 @@ real_t combine_friction(GodotBody3D *A, GodotBody3D *B) {
 }
 
 bool GodotBodyPair3D::setup(real_t p_step) {
-	check_ccd = false;
-
 	if (!A->interacts_with(B) || A->has_exception(B->get_self()) || B->has_exception(A->get_self())) {
 		collided = false;
+		manifold_valid = false;
 		return false;
 	}
 
@@ -275,14 +322,13 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 			report_contacts_only = true;
 		} else {
 			collided = false;
+			manifold_valid = false;
 			return false;
 		}
 	}
 
 	offset_B = B->get_transform().get_origin() - A->get_transform().get_origin();
 
-	validate_contacts();
-
 	const Vector3 &offset_A = A->get_transform().get_origin();
 	Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
 	Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
@@ -294,20 +340,46 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 	GodotShape3D *shape_A_ptr = A->get_shape(shape_A);
 	GodotShape3D *shape_B_ptr = B->get_shape(shape_B);
 
-	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+	Transform3D relative_xform;
+	Transform3D relative_xform_inv;
+	bool relative_xform_computed = false;
+	if (_can_reuse_manifold(shape_A_ptr, xform_A, shape_B_ptr, xform_B, relative_xform, relative_xform_inv, relative_xform_computed)) {
+		// Keep the contacts as they are, their depths are updated from the current transforms in
+		// pre_solve(). This still drops contacts that separated, or that the last narrow phase
+		// didn't generate again. The rest count as generated for this step.
+		validate_contacts();
+		for (int i = 0; i < contact_count; i++) {
+			contacts[i].used = true;
+			contacts[i].acc_impulse = Vector3();
+		}
 
-	if (!collided) {
-		if (A->is_continuous_collision_detection_enabled() && collide_A) {
-			check_ccd = true;
+		if (contact_count > 0) {
+			collided = true;
 			return true;
 		}
+	}
 
-		if (B->is_continuous_collision_detection_enabled() && collide_B) {
-			check_ccd = true;
-			return true;
+	validate_contacts();
+
+	collided = GodotCollisionSolver3D::solve_static(shape_A_ptr, xform_A, shape_B_ptr, xform_B, _contact_added_callback, this, &sep_axis);
+
+	// Without a reuse threshold, the manifold is never checked and doesn't need to be kept.
+	manifold_valid = collided && space->get_contact_reuse_threshold() > 0.0;
+	if (manifold_valid) {
+		if (!relative_xform_computed) {
+			relative_xform = xform_A.affine_inverse() * xform_B;
+			relative_xform_inv = relative_xform.affine_inverse();
 		}
+		manifold_xform = relative_xform;
+		manifold_xform_inv = relative_xform_inv;
+	}
 
-		return false;
+	if (!collided) {
+		if ((A->is_continuous_collision_detection_enabled() && collide_A) || (B->is_continuous_collision_detection_enabled() && collide_B)) {
+			collided = _add_speculative_contact(p_step, shape_A_ptr, xform_A, shape_B_ptr, xform_B);
+		}
+
+		return collided;
 	}
 
 	return true;
@@ -315,24 +387,6 @@ bool GodotBodyPair3D::setup(real_t p_step) {
 
 bool GodotBodyPair3D::pre_solve(real_t p_step) {
 	if (!collided) {
-		if (check_ccd) {
-			const Vector3 &offset_A = A->get_transform().get_origin();
-			Transform3D xform_Au = Transform3D(A->get_transform().basis, Vector3());
-			Transform3D xform_A = xform_Au * A->get_shape_transform(shape_A);
-
-			Transform3D xform_Bu = B->get_transform();
-			xform_Bu.origin -= offset_A;
-			Transform3D xform_B = xform_Bu * B->get_shape_transform(shape_B);
-
-			if (A->is_continuous_collision_detection_enabled() && collide_A) {
-				_test_ccd(p_step, A, shape_A, xform_A, B, shape_B, xform_B);
-			}
-
-			if (B->is_continuous_collision_detection_enabled() && collide_B) {
-				_test_ccd(p_step, B, shape_B, xform_B, A, shape_A, xform_A);
-			}
-		}
-
 		return false;
 	}
 
@@ -381,17 +435,10 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 		Vector3 axis = global_A - global_B;
 		real_t depth = axis.dot(c.normal);
 
-		if (depth <= 0.0) {
+		if (depth <= 0.0 && !c.speculative) {
 			continue;
 		}
 
-#ifdef DEBUG_ENABLED
-		if (space->is_debugging_contacts()) {
-			space->add_debug_contact(global_A + offset_A);
-			space->add_debug_contact(global_B + offset_A);
-		}
-#endif
-
 		c.rA = global_A - A->get_center_of_mass();
 		c.rB = global_B - B->get_center_of_mass() - offset_B;
 
@@ -402,6 +449,24 @@ bool GodotBodyPair3D::pre_solve(real_t p_step) {
 		kNormal += c.normal.dot(inertia_A.cross(c.rA)) + c.normal.dot(inertia_B.cross(c.rB));
 		c.mass_normal = 1.0f / kNormal;
 
+		if (c.speculative) {
+			// Not touching yet, so no bias, warm starting or reporting. The solver only removes
+			// the part of the approach velocity that would close more than the gap this step.
+			c.bias = 0.0;
+			c.depth = depth;
+			c.bounce = -depth * inv_dt;
+			c.active = true;
+			do_process = true;
+			continue;
+		}
+
+#ifdef DEBUG_ENABLED
+		if (space->is_debugging_contacts()) {
+			space->add_debug_contact(global_A + offset_A);
+			space->add_debug_contact(global_B + offset_A);
+		}
+#endif
+
 		c.bias = -bias * inv_dt * MIN(0.0f, -depth + max_penetration);
 		c.depth = depth;
 
@@ -483,7 +548,7 @@ void GodotBodyPair3D::solve(real_t p_step) {
 
 		real_t vbn = dbv.dot(c.normal);
 
-		if (Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
+		if (!c.speculative && Math::abs(-vbn + c.bias) > MIN_VELOCITY) {
 			real_t jbn = (-vbn + c.bias) * c.mass_normal;
 			real_t jbnOld = c.acc_bias_impulse;
 			c.acc_bias_impulse = MAX(jbnOld + jbn, 0.0f);
@@ -595,6 +660,10 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+GodotConstraint3D::OrderKey GodotBodyPair3D::get_order_key() const {
+	return make_pair_order_key(A->get_self(), shape_A, B->get_self(), shape_B);
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
 		GodotBodyContact3D(_arr, 2) {
 	A = p_A;
@@ -972,6 +1041,10 @@ void GodotBodySoftBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+GodotConstraint3D::OrderKey GodotBodySoftBodyPair3D::get_order_key() const {
+	return make_pair_order_key(body->get_self(), body_shape, soft_body->get_self(), 0);
+}
+
 GodotBodySoftBodyPair3D::GodotBodySoftBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotSoftBody3D *p_B) :
 		GodotBodyContact3D(&body, 1) {
 	body = p_A;
@@ -35,7 +35,7 @@
 #include "godot_constraint_3d.h"
 #include "godot_soft_body_3d.h"
 
-#include "core/templates/local_vector.h"
+#include "core/templates/small_vector.h"
 
 class GodotBodyContact3D : public GodotConstraint3D {
 protected:
@@ -56,12 +56,12 @@ protected:
 		real_t depth = 0.0;
 		bool active = false;
 		bool used = false;
+		bool speculative = false; // Closest points of separated shapes, only keeps them from closing the gap too fast.
 		Vector3 rA, rB; // Offset in world orientation with respect to center of mass
 	};
 
 	Vector3 sep_axis;
 	bool collided = false;
-	bool check_ccd = false;
 
 	GodotSpace3D *space = nullptr;
 
@@ -97,18 +97,27 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	// Relative transform of the shapes (B in A's space, and the other way around) when the
+	// contacts were last generated. Used to skip the narrow phase while they barely move.
+	Transform3D manifold_xform;
+	Transform3D manifold_xform_inv;
+	bool manifold_valid = false;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
 
 	void validate_contacts();
-	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
+	bool _can_reuse_manifold(const GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B, Transform3D &r_xform, Transform3D &r_xform_inv, bool &r_xform_computed) const;
+	bool _add_speculative_contact(real_t p_step, const GodotShape3D *p_shape_A, const Transform3D &p_xform_A, const GodotShape3D *p_shape_B, const Transform3D &p_xform_B);
 
 public:
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
 
+	virtual OrderKey get_order_key() const override;
+
 	GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B);
 	~GodotBodyPair3D();
 };
@@ -124,7 +133,8 @@ class GodotBodySoftBodyPair3D : public GodotBodyContact3D {
 
 	bool report_contacts_only = false;
 
-	LocalVector<Contact> contacts;
+	// Most pairs only touch a few soft body nodes, keep those contacts inline.
+	SmallVector<Contact, 4> contacts;
 
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
@@ -140,6 +150,8 @@ public:
 	virtual GodotSoftBody3D *get_soft_body_ptr(int p_index) const override { return soft_body; }
 	virtual int get_soft_body_count() const override { return 1; }
 
+	virtual OrderKey get_order_key() const override;
+
 	GodotBodySoftBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotSoftBody3D *p_B);
 	~GodotBodySoftBodyPair3D();
 };
@@ -33,6 +33,7 @@
 
 #include "core/math/aabb.h"
 #include "core/math/math_funcs.h"
+#include "core/templates/local_vector.h"
 
 class GodotCollisionObject3D;
 
@@ -44,6 +45,9 @@ public:
 
 	typedef uint32_t ID;
 
+	// Scratch memory owned by the caller of the concurrent cull functions.
+	typedef LocalVector<uint32_t, uint32_t, true> CullScratch;
+
 	typedef void *(*PairCallback)(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_userdata);
 	typedef void (*UnpairCallback)(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_userdata);
 
@@ -61,6 +65,11 @@ public:
 	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 	virtual int cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) = 0;
 
+	// Same as cull_segment() and cull_aabb(), but safe to call from several threads at once,
+	// as long as the broadphase isn't modified meanwhile.
+	virtual int cull_segment_concurrent(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, CullScratch &r_scratch, int *p_result_indices = nullptr) = 0;
+	virtual int cull_aabb_concurrent(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, CullScratch &r_scratch, int *p_result_indices = nullptr) = 0;
+
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) = 0;
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) = 0;
 
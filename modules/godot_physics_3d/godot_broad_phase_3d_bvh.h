@@ -67,6 +67,7 @@ class GodotBroadPhase3DBVH : public GodotBroadPhase3D {
 
 	static void *_pair_callback(void *, uint32_t, GodotCollisionObject3D *, int, uint32_t, GodotCollisionObject3D *, int);
 	static void _unpair_callback(void *, uint32_t, GodotCollisionObject3D *, int, uint32_t, GodotCollisionObject3D *, int, void *);
+	static void _parallel_for(void (*p_function)(void *, uint32_t), void *p_userdata, uint32_t p_count);
 
 	PairCallback pair_callback = nullptr;
 	void *pair_userdata = nullptr;
@@ -87,6 +88,8 @@ public:
 	virtual int cull_point(const Vector3 &p_point, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
 	virtual int cull_segment(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
 	virtual int cull_aabb(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, int *p_result_indices = nullptr) override;
+	virtual int cull_segment_concurrent(const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D **p_results, int p_max_results, CullScratch &r_scratch, int *p_result_indices = nullptr) override;
+	virtual int cull_aabb_concurrent(const AABB &p_aabb, GodotCollisionObject3D **p_results, int p_max_results, CullScratch &r_scratch, int *p_result_indices = nullptr) override;
 
 	virtual void set_pair_callback(PairCallback p_pair_callback, void *p_userdata) override;
 	virtual void set_unpair_callback(UnpairCallback p_unpair_callback, void *p_userdata) override;
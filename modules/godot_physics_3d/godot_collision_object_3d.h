@@ -72,6 +72,7 @@ private:
 	};
 
 	Vector<Shape> shapes;
+	uint32_t shapes_version = 0; // Changes whenever the shapes or their transforms change.
 	GodotSpace3D *space = nullptr;
 	Transform3D transform;
 	Transform3D inv_transform;
@@ -79,9 +80,8 @@ private:
 
 	SelfList<GodotCollisionObject3D> pending_shape_update_list;
 
-	void _update_shapes();
-
 protected:
+	void _update_shapes();
 	void _update_shapes_with_motion(const Vector3 &p_motion);
 	void _unregister_shapes();
 
@@ -120,6 +120,7 @@ public:
 	void set_shape(int p_index, GodotShape3D *p_shape);
 	void set_shape_transform(int p_index, const Transform3D &p_transform);
 	_FORCE_INLINE_ int get_shape_count() const { return shapes.size(); }
+	_FORCE_INLINE_ uint32_t get_shapes_version() const { return shapes_version; }
 	_FORCE_INLINE_ GodotShape3D *get_shape(int p_index) const {
 		CRASH_BAD_INDEX(p_index, shapes.size());
 		return shapes[p_index].shape;
@@ -31,6 +31,10 @@
 #ifndef GODOT_CONSTRAINT_3D_H
 #define GODOT_CONSTRAINT_3D_H
 
+#include "core/math/math_defs.h"
+#include "core/templates/rid.h"
+#include "core/typedefs.h"
+
 class GodotBody3D;
 class GodotSoftBody3D;
 
@@ -53,6 +57,45 @@ protected:
 	}
 
 public:
+	// Identifies a constraint by what it connects, rather than by when it was created.
+	// Deterministic spaces solve constraints in this order.
+	struct OrderKey {
+		uint64_t first = 0;
+		uint64_t second = 0;
+		uint64_t shapes = 0;
+
+		_FORCE_INLINE_ bool operator<(const OrderKey &p_other) const {
+			if (first != p_other.first) {
+				return first < p_other.first;
+			}
+			if (second != p_other.second) {
+				return second < p_other.second;
+			}
+			return shapes < p_other.shapes;
+		}
+	};
+
+	static OrderKey make_pair_order_key(const RID &p_a, int p_shape_a, const RID &p_b, int p_shape_b) {
+		OrderKey key;
+		if (p_b.get_id() < p_a.get_id()) {
+			key.first = p_b.get_id();
+			key.second = p_a.get_id();
+			key.shapes = ((uint64_t)(uint32_t)p_shape_b << 32) | (uint32_t)p_shape_a;
+		} else {
+			key.first = p_a.get_id();
+			key.second = p_b.get_id();
+			key.shapes = ((uint64_t)(uint32_t)p_shape_a << 32) | (uint32_t)p_shape_b;
+		}
+		return key;
+	}
+
+	// Joints are keyed by their own RID, pairs by the RIDs of the objects they connect.
+	virtual OrderKey get_order_key() const {
+		OrderKey key;
+		key.second = self.get_id();
+		return key;
+	}
+
 	_FORCE_INLINE_ void set_self(const RID &p_self) { self = p_self; }
 	_FORCE_INLINE_ RID get_self() const { return self; }
 
@@ -437,6 +437,13 @@ void GodotPhysicsServer3D::area_set_area_monitor_callback(RID p_area, const Call
 	area->set_area_monitor_callback(p_callback.is_valid() ? p_callback : Callable());
 }
 
+void GodotPhysicsServer3D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	GodotArea3D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_monitor_batch_callback(p_callback.is_valid() ? p_callback : Callable());
+}
+
 /* BODY API */
 
 RID GodotPhysicsServer3D::body_create() {
@@ -1719,6 +1726,11 @@ int GodotPhysicsServer3D::get_process_info(ProcessInfo p_info) {
 		case INFO_ISLAND_COUNT: {
 			return island_count;
 		} break;
+		case INFO_TEMP_MEMORY_PEAK:
+		case INFO_TEMP_MEMORY_CAPACITY: {
+			// Godot Physics doesn't use a temporary memory buffer.
+			return 0;
+		} break;
 	}
 
 	return 0;
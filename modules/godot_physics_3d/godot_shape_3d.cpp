@@ -1346,40 +1346,97 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
-
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
-	}
+void GodotConcavePolygonShape3D::_cull_segment(_SegmentCullParams *p_params) const {
+	const Vector3 delta = p_params->to - p_params->from;
+	const real_t length = delta.length();
+
+	real_t from[3];
+	real_t inv_dir[3];
+	bool parallel[3];
+	for (int a = 0; a < 3; a++) {
+		from[a] = p_params->from[a];
+		parallel[a] = Math::is_zero_approx(delta[a]);
+		inv_dir[a] = parallel[a] ? 0 : 1.0 / delta[a];
+	}
+
+	int stack[BVH_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const BVH &node = bvh[stack[--stack_size]];
+
+		// Slab test of the segment against the four children at once.
+		real_t t_near[BVH_WIDTH];
+		real_t t_far[BVH_WIDTH];
+		for (int i = 0; i < BVH_WIDTH; i++) {
+			t_near[i] = 0;
+			t_far[i] = 1;
+		}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-
-		Vector3 res;
-		Vector3 normal;
-		int face_index = params_bvh->face_index;
-		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
-			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
-			if ((d > 0) && (d < p_params->min_d)) {
-				p_params->min_d = d;
-				p_params->result = res;
-				p_params->normal = normal;
-				p_params->face_index = face_index;
-				p_params->collisions++;
+		for (int a = 0; a < 3; a++) {
+			if (parallel[a]) {
+				for (int i = 0; i < BVH_WIDTH; i++) {
+					t_near[i] = (from[a] < node.min[a][i] || from[a] > node.max[a][i]) ? 2 : t_near[i];
+				}
+			} else {
+				const real_t *near_plane = inv_dir[a] >= 0 ? node.min[a] : node.max[a];
+				const real_t *far_plane = inv_dir[a] >= 0 ? node.max[a] : node.min[a];
+				for (int i = 0; i < BVH_WIDTH; i++) {
+					t_near[i] = MAX(t_near[i], (near_plane[i] - from[a]) * inv_dir[a]);
+					t_far[i] = MIN(t_far[i], (far_plane[i] - from[a]) * inv_dir[a]);
+				}
 			}
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
+
+		// Nothing past the closest hit found so far can replace it.
+		const real_t t_limit = (p_params->collisions > 0 && length > 0) ? p_params->min_d / length : 1;
+
+		int hit_children[BVH_WIDTH];
+		int hit_count = 0;
+
+		for (int i = 0; i < BVH_WIDTH; i++) {
+			if (t_near[i] > t_far[i] || t_near[i] > t_limit) {
+				continue;
+			}
+
+			if (node.face_count[i] > 0) {
+				const int *leaf_faces = &bvh_faces[node.child[i]];
+				for (int j = 0; j < node.face_count[i]; j++) {
+					const Face *f = &p_params->faces[leaf_faces[j]];
+					GodotFaceShape3D *face = p_params->face;
+					face->normal = f->normal;
+					face->vertex[0] = p_params->vertices[f->indices[0]];
+					face->vertex[1] = p_params->vertices[f->indices[1]];
+					face->vertex[2] = p_params->vertices[f->indices[2]];
+
+					Vector3 res;
+					Vector3 normal;
+					int face_index = leaf_faces[j];
+					if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
+						real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
+						if ((d > 0) && (d < p_params->min_d)) {
+							p_params->min_d = d;
+							p_params->result = res;
+							p_params->normal = normal;
+							p_params->face_index = face_index;
+							p_params->collisions++;
+						}
+					}
+				}
+			} else if (node.child[i] >= 0) {
+				// Keep the hit children sorted far to near, so the nearest is popped first.
+				int j = hit_count++;
+				while (j > 0 && t_near[hit_children[j - 1]] < t_near[i]) {
+					hit_children[j] = hit_children[j - 1];
+					j--;
+				}
+				hit_children[j] = i;
+			}
 		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
+
+		for (int i = 0; i < hit_count; i++) {
+			stack[stack_size++] = node.child[hit_children[i]];
 		}
 	}
 }
@@ -1392,7 +1449,6 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 	// unlock data
 	const Face *fr = faces.ptr();
 	const Vector3 *vr = vertices.ptr();
-	const BVH *br = bvh.ptr();
 
 	GodotFaceShape3D face;
 	face.backface_collision = backface_collision && p_hit_back_faces;
@@ -1404,12 +1460,11 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 
 	params.faces = fr;
 	params.vertices = vr;
-	params.bvh = br;
 
 	params.face = &face;
 
 	// cull
-	_cull_segment(0, &params);
+	_cull_segment(&params);
 
 	if (params.collisions > 0) {
 		r_result = params.result;
@@ -1429,33 +1484,65 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 	return Vector3();
 }
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+bool GodotConcavePolygonShape3D::_cull(_CullParams *p_params) const {
+	const Vector3 aabb_end = p_params->aabb.get_end();
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
+	real_t query_min[3];
+	real_t query_max[3];
+	for (int a = 0; a < 3; a++) {
+		query_min[a] = p_params->aabb.position[a];
+		query_max[a] = aabb_end[a];
 	}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
-		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
-		if (p_params->callback(p_params->userdata, face)) {
-			return true;
+	int stack[BVH_STACK_SIZE];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const BVH &node = bvh[stack[--stack_size]];
+
+		// Same strict overlap test as AABB::intersects(), for the four children at once.
+		bool overlap[BVH_WIDTH];
+		for (int i = 0; i < BVH_WIDTH; i++) {
+			overlap[i] = (node.min[0][i] < query_max[0]) & (node.max[0][i] > query_min[0]) &
+					(node.min[1][i] < query_max[1]) & (node.max[1][i] > query_min[1]) &
+					(node.min[2][i] < query_max[2]) & (node.max[2][i] > query_min[2]);
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
+
+		for (int i = 0; i < BVH_WIDTH; i++) {
+			if (!overlap[i]) {
+				continue;
 			}
-		}
 
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
+			if (node.face_count[i] == 0) {
+				if (node.child[i] >= 0) {
+					stack[stack_size++] = node.child[i];
+				}
+				continue;
+			}
+
+			const int *leaf_faces = &bvh_faces[node.child[i]];
+			for (int j = 0; j < node.face_count[i]; j++) {
+				const Face *f = &p_params->faces[leaf_faces[j]];
+				const Vector3 &v0 = p_params->vertices[f->indices[0]];
+				const Vector3 &v1 = p_params->vertices[f->indices[1]];
+				const Vector3 &v2 = p_params->vertices[f->indices[2]];
+
+				AABB face_aabb(v0, Vector3());
+				face_aabb.expand_to(v1);
+				face_aabb.expand_to(v2);
+				if (!p_params->aabb.intersects(face_aabb)) {
+					continue;
+				}
+
+				GodotFaceShape3D *face = p_params->face;
+				face->normal = f->normal;
+				face->vertex[0] = v0;
+				face->vertex[1] = v1;
+				face->vertex[2] = v2;
+				if (p_params->callback(p_params->userdata, face)) {
+					return true;
+				}
 			}
 		}
 	}
@@ -1474,7 +1561,6 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	// unlock data
 	const Face *fr = faces.ptr();
 	const Vector3 *vr = vertices.ptr();
-	const BVH *br = bvh.ptr();
 
 	GodotFaceShape3D face; // use this to send in the callback
 	face.backface_collision = backface_collision;
@@ -1485,12 +1571,11 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
-	params.bvh = br;
 	params.callback = p_callback;
 	params.userdata = p_userdata;
 
 	// cull
-	_cull(0, &params);
+	_cull(&params);
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1527,87 +1612,193 @@ struct _Volume_BVH_CompareZ {
 	}
 };
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
+static _FORCE_INLINE_ real_t _volume_bvh_half_area(const AABB &p_aabb) {
+	const Vector3 &size = p_aabb.size;
+	return size.x * size.y + size.y * size.z + size.z * size.x;
+}
 
-	int face_index = 0;
-};
+static AABB _volume_bvh_get_aabb(const _Volume_BVH_Element *p_elements, int p_count) {
+	AABB aabb = p_elements[0].aabb;
+	for (int i = 1; i < p_count; i++) {
+		aabb.merge_with(p_elements[i].aabb);
+	}
+	return aabb;
+}
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
-
-	if (p_size == 1) {
-		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+// Partitions the elements in two with a binned surface area heuristic, falling back to a
+// median split along the longest axis when binning can't tell the elements apart.
+// Returns the number of elements that went to the first half.
+static int _volume_bvh_split(_Volume_BVH_Element *p_elements, int p_count, bool p_use_sah) {
+	AABB centers(p_elements[0].center, Vector3());
+	for (int i = 1; i < p_count; i++) {
+		centers.expand_to(p_elements[i].center);
 	}
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
+	const int axis = centers.get_longest_axis_index();
+	const real_t extent = centers.size[axis];
+
+	if (p_use_sah && extent > 0) {
+		const int bin_count = GodotConcavePolygonShape3D::BVH_SAH_BINS;
+		const real_t to_bin = bin_count / extent;
+		const real_t axis_min = centers.position[axis];
+
+		int bin_elements[bin_count] = {};
+		AABB bin_aabbs[bin_count];
+		for (int i = 0; i < p_count; i++) {
+			const int bin = MIN(int((p_elements[i].center[axis] - axis_min) * to_bin), bin_count - 1);
+			if (bin_elements[bin] == 0) {
+				bin_aabbs[bin] = p_elements[i].aabb;
+			} else {
+				bin_aabbs[bin].merge_with(p_elements[i].aabb);
+			}
+			bin_elements[bin]++;
+		}
+
+		// Cost of the elements right of each split plane.
+		real_t right_cost[bin_count] = {};
+		AABB right_aabb;
+		int right_count = 0;
+		for (int i = bin_count - 1; i > 0; i--) {
+			if (bin_elements[i] > 0) {
+				right_aabb = right_count == 0 ? bin_aabbs[i] : right_aabb.merge(bin_aabbs[i]);
+				right_count += bin_elements[i];
+			}
+			right_cost[i] = right_count > 0 ? _volume_bvh_half_area(right_aabb) * right_count : 0;
+		}
+
+		int best_split = -1;
+		real_t best_cost = 0;
+		AABB left_aabb;
+		int left_count = 0;
+		for (int i = 1; i < bin_count; i++) {
+			if (bin_elements[i - 1] > 0) {
+				left_aabb = left_count == 0 ? bin_aabbs[i - 1] : left_aabb.merge(bin_aabbs[i - 1]);
+				left_count += bin_elements[i - 1];
+			}
+			if (left_count == 0 || left_count == p_count) {
+				continue;
+			}
+			const real_t cost = _volume_bvh_half_area(left_aabb) * left_count + right_cost[i];
+			if (best_split < 0 || cost < best_cost) {
+				best_split = i;
+				best_cost = cost;
+			}
+		}
+
+		if (best_split > 0) {
+			int left = 0;
+			int right = p_count - 1;
+			while (left <= right) {
+				const int bin = MIN(int((p_elements[left].center[axis] - axis_min) * to_bin), bin_count - 1);
+				if (bin < best_split) {
+					left++;
+				} else {
+					SWAP(p_elements[left], p_elements[right]);
+					right--;
+				}
+			}
+			return left;
 		}
 	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
+
+	switch (axis) {
 		case 0: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
-
+			sort_x.sort(p_elements, p_count);
 		} break;
 		case 1: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
+			sort_y.sort(p_elements, p_count);
 		} break;
 		case 2: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
+			sort_z.sort(p_elements, p_count);
 		} break;
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
-
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
+	return p_count / 2;
 }
 
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
+int GodotConcavePolygonShape3D::_build_bvh_node(_Volume_BVH_Element *p_elements, int p_first, int p_count, int p_depth) {
+	struct Range {
+		AABB aabb;
+		int first = 0;
+		int count = 0;
+	};
 
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
+	Range ranges[BVH_WIDTH];
+	int range_count = 1;
+	ranges[0].aabb = _volume_bvh_get_aabb(&p_elements[p_first], p_count);
+	ranges[0].first = p_first;
+	ranges[0].count = p_count;
+
+	// Keep splitting the range with the largest area until the node is full.
+	// Ranges small enough to become leaves are left alone.
+	const bool use_sah = p_depth < BVH_MAX_SAH_DEPTH;
+	while (range_count < BVH_WIDTH) {
+		int best = -1;
+		real_t best_area = 0;
+		for (int i = 0; i < range_count; i++) {
+			if (ranges[i].count <= BVH_MAX_LEAF_FACES) {
+				continue;
+			}
+			const real_t area = _volume_bvh_half_area(ranges[i].aabb);
+			if (best < 0 || area > best_area) {
+				best = i;
+				best_area = area;
+			}
+		}
 
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
+		if (best < 0) {
+			break;
+		}
 
-	} else {
-		p_bvh_array[p_idx].left = -1;
+		Range &left = ranges[best];
+		Range &right = ranges[range_count++];
+		const int left_count = _volume_bvh_split(&p_elements[left.first], left.count, use_sah);
+		right.first = left.first + left_count;
+		right.count = left.count - left_count;
+		right.aabb = _volume_bvh_get_aabb(&p_elements[right.first], right.count);
+		left.count = left_count;
+		left.aabb = _volume_bvh_get_aabb(&p_elements[left.first], left.count);
 	}
 
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
+	const int node_index = bvh.size();
+	bvh.push_back(BVH());
 
-	} else {
-		p_bvh_array[p_idx].right = -1;
+	for (int i = 0; i < BVH_WIDTH; i++) {
+		BVH &node = bvh[node_index];
+
+		if (i >= range_count) {
+			// Inverted bounds, so unused slots never pass any test.
+			for (int a = 0; a < 3; a++) {
+				node.min[a][i] = 1e20;
+				node.max[a][i] = -1e20;
+			}
+			node.child[i] = -1;
+			node.face_count[i] = 0;
+			continue;
+		}
+
+		const Range &range = ranges[i];
+		const Vector3 end = range.aabb.get_end();
+		for (int a = 0; a < 3; a++) {
+			node.min[a][i] = range.aabb.position[a];
+			node.max[a][i] = end[a];
+		}
+
+		if (range.count <= BVH_MAX_LEAF_FACES) {
+			node.child[i] = range.first;
+			node.face_count[i] = range.count;
+		} else {
+			// Building the child may reallocate the nodes, so don't keep the reference around.
+			const int child = _build_bvh_node(p_elements, range.first, range.count, p_depth + 1);
+			bvh[node_index].child[i] = child;
+			bvh[node_index].face_count[i] = 0;
+		}
 	}
 
-	memdelete(p_bvh_tree);
+	return node_index;
 }
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
@@ -1655,15 +1846,15 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		}
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
-
-	bvh.resize(count + 1);
-
-	BVH *bvh_arrayw2 = bvh.ptrw();
+	bvh.clear();
+	bvh.reserve(src_face_count / BVH_MAX_LEAF_FACES + 1);
+	_build_bvh_node(bvh_arrayw, 0, src_face_count, 0);
 
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
+	// Leaves reference their faces through this, in the order the build left them.
+	bvh_faces.resize(src_face_count);
+	for (int i = 0; i < src_face_count; i++) {
+		bvh_faces[i] = bvh_arrayw[i].face_index;
+	}
 
 	backface_collision = p_backface_collision;
 
@@ -302,7 +302,7 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
+struct _Volume_BVH_Element;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -316,15 +316,29 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
 
-	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
+	enum {
+		BVH_WIDTH = 4,
+		BVH_MAX_LEAF_FACES = 4,
+		BVH_SAH_BINS = 12,
+		// Past this depth the build falls back to median splits, which keeps the
+		// tree (and the traversal stacks) bounded even for degenerate meshes.
+		BVH_MAX_SAH_DEPTH = 48,
+		BVH_STACK_SIZE = 256,
+	};
 
-		int face_index = 0;
+	// 4-wide node. The bounds of the children are stored per axis, so a query
+	// tests all of them in one go with straight loops the compiler can vectorize.
+	struct BVH {
+		real_t min[3][BVH_WIDTH];
+		real_t max[3][BVH_WIDTH];
+		// Inner children point to a node, leaves to their first entry in bvh_faces.
+		int child[BVH_WIDTH];
+		// Faces in a leaf child, 0 for inner children and unused slots.
+		int face_count[BVH_WIDTH];
 	};
 
-	Vector<BVH> bvh;
+	LocalVector<BVH> bvh;
+	LocalVector<int> bvh_faces;
 
 	struct _CullParams {
 		AABB aabb;
@@ -332,7 +346,6 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
 		GodotFaceShape3D *face = nullptr;
 	};
 
@@ -342,7 +355,6 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		Vector3 dir;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
 		GodotFaceShape3D *face = nullptr;
 
 		Vector3 result;
@@ -354,10 +366,10 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	void _cull_segment(_SegmentCullParams *p_params) const;
+	bool _cull(_CullParams *p_params) const;
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	int _build_bvh_node(_Volume_BVH_Element *p_elements, int p_first, int p_count, int p_depth);
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
@@ -107,17 +108,13 @@ int GodotPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_par
 	return cc;
 }
 
-bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V(space->locked, false);
-
+bool GodotPhysicsDirectSpaceState3D::_intersect_ray_candidates(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_shapes, int p_candidate_count, RayResult &r_result) const {
 	Vector3 begin, end;
 	Vector3 normal;
-	begin = p_parameters.from;
-	end = p_parameters.to;
+	begin = p_from;
+	end = p_to;
 	normal = (end - begin).normalized();
 
-	int amount = space->broadphase->cull_segment(begin, end, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
-
 	//todo, create another array that references results, compute AABBs and check closest point to ray origin, sort, and stop evaluating results when beyond first collision
 
 	bool collided = false;
@@ -127,22 +124,22 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	const GodotCollisionObject3D *res_obj = nullptr;
 	real_t min_d = 1e10;
 
-	for (int i = 0; i < amount; i++) {
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+	for (int i = 0; i < p_candidate_count; i++) {
+		if (!_can_collide_with(p_candidates[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
-		if (p_parameters.pick_ray && !(space->intersection_query_results[i]->is_ray_pickable())) {
+		if (p_parameters.pick_ray && !(p_candidates[i]->is_ray_pickable())) {
 			continue;
 		}
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_candidates[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
+		const GodotCollisionObject3D *col_obj = p_candidates[i];
 
-		int shape_idx = space->intersection_query_subindex_results[i];
+		int shape_idx = p_candidate_shapes[i];
 		Transform3D inv_xform = col_obj->get_shape_inv_transform(shape_idx) * col_obj->get_inv_transform();
 
 		Vector3 local_from = inv_xform.xform(begin);
@@ -207,41 +204,38 @@ bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parame
 	return true;
 }
 
-int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
-	if (p_result_max <= 0) {
-		return 0;
-	}
-
-	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, 0);
+bool GodotPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V(space->locked, false);
 
-	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
+	int amount = space->broadphase->cull_segment(p_parameters.from, p_parameters.to, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
 
-	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+	return _intersect_ray_candidates(p_parameters, p_parameters.from, p_parameters.to, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_result);
+}
 
+int GodotPhysicsDirectSpaceState3D::_intersect_shape_candidates(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, const Transform3D &p_transform, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_shapes, int p_candidate_count, ShapeResult *r_results, int p_result_max) const {
 	int cc = 0;
 
 	//Transform3D ai = p_xform.affine_inverse();
 
-	for (int i = 0; i < amount; i++) {
+	for (int i = 0; i < p_candidate_count; i++) {
 		if (cc >= p_result_max) {
 			break;
 		}
 
-		if (!_can_collide_with(space->intersection_query_results[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
+		if (!_can_collide_with(p_candidates[i], p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas)) {
 			continue;
 		}
 
 		//area can't be picked by ray (default)
 
-		if (p_parameters.exclude.has(space->intersection_query_results[i]->get_self())) {
+		if (p_parameters.exclude.has(p_candidates[i]->get_self())) {
 			continue;
 		}
 
-		const GodotCollisionObject3D *col_obj = space->intersection_query_results[i];
-		int shape_idx = space->intersection_query_subindex_results[i];
+		const GodotCollisionObject3D *col_obj = p_candidates[i];
+		int shape_idx = p_candidate_shapes[i];
 
-		if (!GodotCollisionSolver3D::solve_static(shape, p_parameters.transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
+		if (!GodotCollisionSolver3D::solve_static(p_shape, p_transform, col_obj->get_shape(shape_idx), col_obj->get_transform() * col_obj->get_shape_transform(shape_idx), nullptr, nullptr, nullptr, p_parameters.margin, 0)) {
 			continue;
 		}
 
@@ -262,6 +256,98 @@ int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_par
 	return cc;
 }
 
+int GodotPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	if (p_result_max <= 0) {
+		return 0;
+	}
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, 0);
+
+	AABB aabb = p_parameters.transform.xform(shape->get_aabb());
+
+	int amount = space->broadphase->cull_aabb(aabb, space->intersection_query_results, GodotSpace3D::INTERSECTION_QUERY_MAX, space->intersection_query_subindex_results);
+
+	return _intersect_shape_candidates(p_parameters, shape, p_parameters.transform, space->intersection_query_results, space->intersection_query_subindex_results, amount, r_results, p_result_max);
+}
+
+thread_local GodotPhysicsDirectSpaceState3D::QueryScratch GodotPhysicsDirectSpaceState3D::query_scratch;
+
+GodotPhysicsDirectSpaceState3D::QueryScratch &GodotPhysicsDirectSpaceState3D::_get_query_scratch() {
+	if (unlikely(query_scratch.candidates.is_empty())) {
+		query_scratch.candidates.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+		query_scratch.candidate_shapes.resize(GodotSpace3D::INTERSECTION_QUERY_MAX);
+	}
+	return query_scratch;
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_task(uint32_t p_index, RayBatch *p_batch) {
+	const Vector3 &from = p_batch->from[p_index];
+	const Vector3 &to = p_batch->to[p_index];
+	QueryScratch &scratch = _get_query_scratch();
+
+	int amount = space->broadphase->cull_segment_concurrent(from, to, scratch.candidates.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, scratch.cull, scratch.candidate_shapes.ptr());
+
+	p_batch->hits[p_index] = _intersect_ray_candidates(*p_batch->parameters, from, to, scratch.candidates.ptr(), scratch.candidate_shapes.ptr(), amount, p_batch->results[p_index]);
+}
+
+void GodotPhysicsDirectSpaceState3D::_intersect_shape_batch_task(uint32_t p_index, ShapeBatch *p_batch) {
+	const Transform3D &transform = p_batch->transforms[p_index];
+	AABB aabb = transform.xform(p_batch->shape->get_aabb());
+	QueryScratch &scratch = _get_query_scratch();
+
+	int amount = space->broadphase->cull_aabb_concurrent(aabb, scratch.candidates.ptr(), GodotSpace3D::INTERSECTION_QUERY_MAX, scratch.cull, scratch.candidate_shapes.ptr());
+
+	p_batch->result_counts[p_index] = _intersect_shape_candidates(*p_batch->parameters, p_batch->shape, transform, scratch.candidates.ptr(), scratch.candidate_shapes.ptr(), amount, &p_batch->results[p_index * p_batch->result_max], p_batch->result_max);
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	for (int i = 0; i < p_count; i++) {
+		r_hits[i] = false;
+	}
+
+	ERR_FAIL_COND(space->locked);
+	if (p_count <= 0) {
+		return;
+	}
+
+	// The space can't change while this function runs, so the broadphase can be culled from all the threads.
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_ray_batch_task, &batch, p_count, -1, true, SNAME("Physics3DIntersectRayBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void GodotPhysicsDirectSpaceState3D::intersect_shape_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	for (int i = 0; i < p_count; i++) {
+		r_result_counts[i] = 0;
+	}
+
+	ERR_FAIL_COND(space->locked);
+	if (p_count <= 0 || p_result_max <= 0) {
+		return;
+	}
+
+	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	ShapeBatch batch;
+	batch.parameters = &p_parameters;
+	batch.shape = shape;
+	batch.transforms = p_transforms;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotPhysicsDirectSpaceState3D::_intersect_shape_batch_task, &batch, p_count, -1, true, SNAME("Physics3DIntersectShapeBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool GodotPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &p_closest_safe, real_t &p_closest_unsafe, ShapeRestInfo *r_info) {
 	GodotShape3D *shape = GodotPhysicsServer3D::godot_singleton->shape_owner.get_or_null(p_parameters.shape_rid);
 	ERR_FAIL_NULL_V(shape, false);
@@ -1042,6 +1128,12 @@ void *GodotSpace3D::_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A
 
 	GodotSpace3D *self = static_cast<GodotSpace3D *>(p_self);
 
+	if (self->deterministic && type_A == type_B && B->get_self().get_id() < A->get_self().get_id()) {
+		// Which object the broadphase reports first depends on the history of the space.
+		SWAP(A, B);
+		SWAP(p_subindex_A, p_subindex_B);
+	}
+
 	self->collision_pairs++;
 
 	if (type_A == GodotCollisionObject3D::TYPE_AREA) {
@@ -1215,6 +1307,12 @@ void GodotSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, real_t p_v
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			solver_iterations = p_value;
 			break;
+		case PhysicsServer3D::SPACE_PARAM_CONTACT_REUSE_THRESHOLD:
+			contact_reuse_threshold = p_value;
+			break;
+		case PhysicsServer3D::SPACE_PARAM_DETERMINISTIC:
+			deterministic = p_value != 0.0;
+			break;
 	}
 }
 
@@ -1236,6 +1334,10 @@ real_t GodotSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 			return body_time_to_sleep;
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS:
 			return solver_iterations;
+		case PhysicsServer3D::SPACE_PARAM_CONTACT_REUSE_THRESHOLD:
+			return contact_reuse_threshold;
+		case PhysicsServer3D::SPACE_PARAM_DETERMINISTIC:
+			return deterministic ? 1.0 : 0.0;
 	}
 	return 0;
 }
@@ -1265,6 +1367,8 @@ GodotSpace3D::GodotSpace3D() {
 	contact_max_separation = GLOBAL_GET("physics/3d/solver/contact_max_separation");
 	contact_max_allowed_penetration = GLOBAL_GET("physics/3d/solver/contact_max_allowed_penetration");
 	contact_bias = GLOBAL_GET("physics/3d/solver/default_contact_bias");
+	contact_reuse_threshold = GLOBAL_GET("physics/3d/solver/contact_reuse_threshold");
+	deterministic = GLOBAL_GET("physics/3d/solver/deterministic");
 
 	broadphase = GodotBroadPhase3D::create_func();
 	broadphase->set_pair_callback(_broadphase_pair, this);
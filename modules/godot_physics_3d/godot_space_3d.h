@@ -42,6 +42,39 @@
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+	};
+
+	struct ShapeBatch {
+		const ShapeParameters *parameters = nullptr;
+		const GodotShape3D *shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+	};
+
+	// Broadphase results of the batched queries, one per thread.
+	struct QueryScratch {
+		LocalVector<GodotCollisionObject3D *> candidates;
+		LocalVector<int> candidate_shapes;
+		GodotBroadPhase3D::CullScratch cull;
+	};
+
+	static thread_local QueryScratch query_scratch;
+	static QueryScratch &_get_query_scratch();
+
+	bool _intersect_ray_candidates(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_shapes, int p_candidate_count, RayResult &r_result) const;
+	int _intersect_shape_candidates(const ShapeParameters &p_parameters, const GodotShape3D *p_shape, const Transform3D &p_transform, GodotCollisionObject3D *const *p_candidates, const int *p_candidate_shapes, int p_candidate_count, ShapeResult *r_results, int p_result_max) const;
+
+	void _intersect_ray_batch_task(uint32_t p_index, RayBatch *p_batch);
+	void _intersect_shape_batch_task(uint32_t p_index, ShapeBatch *p_batch);
+
 public:
 	GodotSpace3D *space = nullptr;
 
@@ -53,6 +86,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const override;
 
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override;
+	virtual void intersect_shape_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
+
 	GodotPhysicsDirectSpaceState3D();
 };
 
@@ -95,6 +131,8 @@ private:
 	real_t contact_max_separation = 0.0;
 	real_t contact_max_allowed_penetration = 0.0;
 	real_t contact_bias = 0.0;
+	real_t contact_reuse_threshold = 0.0;
+	bool deterministic = false;
 
 	enum {
 		INTERSECTION_QUERY_MAX = 2048
@@ -161,6 +199,8 @@ public:
 	_FORCE_INLINE_ real_t get_contact_max_separation() const { return contact_max_separation; }
 	_FORCE_INLINE_ real_t get_contact_max_allowed_penetration() const { return contact_max_allowed_penetration; }
 	_FORCE_INLINE_ real_t get_contact_bias() const { return contact_bias; }
+	_FORCE_INLINE_ real_t get_contact_reuse_threshold() const { return contact_reuse_threshold; }
+	_FORCE_INLINE_ bool is_deterministic() const { return deterministic; }
 	_FORCE_INLINE_ real_t get_body_linear_velocity_sleep_threshold() const { return body_linear_velocity_sleep_threshold; }
 	_FORCE_INLINE_ real_t get_body_angular_velocity_sleep_threshold() const { return body_angular_velocity_sleep_threshold; }
 	_FORCE_INLINE_ real_t get_body_time_to_sleep() const { return body_time_to_sleep; }
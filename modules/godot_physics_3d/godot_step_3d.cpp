@@ -41,7 +41,7 @@
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
 
-void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
+void GodotStep3D::_populate_island(GodotBody3D *p_body, ArenaVector<GodotBody3D *> &p_body_island, ArenaVector<GodotConstraint3D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
 
 	if (p_body->get_mode() > PhysicsServer3D::BODY_MODE_KINEMATIC) {
@@ -85,7 +85,7 @@ void GodotStep3D::_populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D
 	}
 }
 
-void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island) {
+void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, ArenaVector<GodotBody3D *> &p_body_island, ArenaVector<GodotConstraint3D *> &p_constraint_island) {
 	p_soft_body->set_island_step(_step);
 
 	for (GodotConstraint3D *E : p_soft_body->get_constraints()) {
@@ -117,7 +117,29 @@ void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdat
 	constraint->setup(delta);
 }
 
-void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const {
+void GodotStep3D::_gather_active_bodies(const SelfList<GodotBody3D>::List *p_body_list) {
+	active_bodies.clear();
+	const SelfList<GodotBody3D> *b = p_body_list->first();
+	while (b) {
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	if (deterministic) {
+		// The active list is in activation order, which depends on the history of the space.
+		active_bodies.sort_custom<BodyOrderComparator>();
+	}
+}
+
+void GodotStep3D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep3D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
+
+void GodotStep3D::_pre_solve_island(ArenaVector<GodotConstraint3D *> &p_constraint_island) const {
 	uint32_t constraint_count = p_constraint_island.size();
 	uint32_t valid_constraint_count = 0;
 	for (uint32_t constraint_index = 0; constraint_index < constraint_count; ++constraint_index) {
@@ -131,7 +153,7 @@ void GodotStep3D::_pre_solve_island(LocalVector<GodotConstraint3D *> &p_constrai
 }
 
 void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
-	LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
+	ArenaVector<GodotConstraint3D *> &constraint_island = constraint_islands[p_island_index];
 
 	int current_priority = 1;
 
@@ -158,7 +180,7 @@ void GodotStep3D::_solve_island(uint32_t p_island_index, void *p_userdata) {
 	}
 }
 
-void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const {
+void GodotStep3D::_check_suspend(const ArenaVector<GodotBody3D *> &p_body_island) const {
 	bool can_sleep = true;
 
 	uint32_t body_count = p_body_island.size();
@@ -183,6 +205,9 @@ void GodotStep3D::_check_suspend(const LocalVector<GodotBody3D *> &p_body_island
 }
 
 void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
+	// Islands are allocated from the frame arena and released in bulk when the step ends.
+	FrameArena::Scope arena_scope;
+
 	p_space->lock(); // can't access space during this
 
 	p_space->setup(); //update inertias, etc
@@ -191,6 +216,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	iterations = p_space->get_solver_iterations();
 	delta = p_delta;
+	deterministic = p_space->is_deterministic();
 
 	const SelfList<GodotBody3D>::List *body_list = &p_space->get_active_body_list();
 
@@ -201,13 +227,17 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	// Bodies are integrated in parallel, then the results that touch the space
+	// and the broadphase are committed serially in active list order, so the
+	// outcome doesn't depend on the number of threads.
+	_gather_active_bodies(body_list);
+	int active_count = active_bodies.size();
 
-	const SelfList<GodotBody3D> *b = body_list->first();
-	while (b) {
-		b->self()->integrate_forces(p_delta);
-		b = b->next();
-		active_count++;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_forces, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (GodotBody3D *body : active_bodies) {
+		body->commit_integrate_forces();
 	}
 
 	/* UPDATE SOFT BODY MOTION */
@@ -234,8 +264,12 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	uint32_t island_count = 0;
 
+	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
+	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
+
 	const SelfList<GodotArea3D>::List &aml = p_space->get_moved_area_list();
 
+	ArenaVector<GodotConstraint3D *> area_constraints;
 	while (aml.first()) {
 		for (GodotConstraint3D *E : aml.first()->self()->get_constraints()) {
 			GodotConstraint3D *constraint = E;
@@ -243,36 +277,42 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 				continue;
 			}
 			constraint->set_island_step(_step);
+			area_constraints.push_back(constraint);
+		}
+		p_space->area_remove_from_moved_list((SelfList<GodotArea3D> *)aml.first()); //faster to remove here
+	}
 
-			// Each constraint can be on a separate island for areas as there's no solving phase.
-			++island_count;
-			if (constraint_islands.size() < island_count) {
-				constraint_islands.resize(island_count);
-			}
-			LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_count - 1];
-			constraint_island.clear();
+	if (deterministic) {
+		area_constraints.sort_custom<ConstraintOrderComparator>();
+	}
 
-			all_constraints.push_back(constraint);
-			constraint_island.push_back(constraint);
+	for (GodotConstraint3D *constraint : area_constraints) {
+		// Each constraint can be on a separate island for areas as there's no solving phase.
+		++island_count;
+		if (constraint_islands.size() < island_count) {
+			constraint_islands.resize(island_count);
 		}
-		p_space->area_remove_from_moved_list((SelfList<GodotArea3D> *)aml.first()); //faster to remove here
+		ArenaVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_count - 1];
+		constraint_island.clear();
+
+		all_constraints.push_back(constraint);
+		constraint_island.push_back(constraint);
 	}
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE RIGID BODIES */
 
-	b = body_list->first();
+	// Pairs created by the broadphase may have activated kinematic bodies.
+	_gather_active_bodies(body_list);
 
 	uint32_t body_island_count = 0;
 
-	while (b) {
-		GodotBody3D *body = b->self();
-
+	for (GodotBody3D *body : active_bodies) {
 		if (body->get_island_step() != _step) {
 			++body_island_count;
 			if (body_islands.size() < body_island_count) {
 				body_islands.resize(body_island_count);
 			}
-			LocalVector<GodotBody3D *> &body_island = body_islands[body_island_count - 1];
+			ArenaVector<GodotBody3D *> &body_island = body_islands[body_island_count - 1];
 			body_island.clear();
 			body_island.reserve(BODY_ISLAND_SIZE_RESERVE);
 
@@ -280,7 +320,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 			if (constraint_islands.size() < island_count) {
 				constraint_islands.resize(island_count);
 			}
-			LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_count - 1];
+			ArenaVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_count - 1];
 			constraint_island.clear();
 			constraint_island.reserve(ISLAND_SIZE_RESERVE);
 
@@ -292,9 +332,11 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 			if (constraint_island.is_empty()) {
 				--island_count;
+			} else if (deterministic) {
+				// Constraints were found in the order they were added to their bodies.
+				constraint_island.sort_custom<ConstraintOrderComparator>();
 			}
 		}
-		b = b->next();
 	}
 
 	/* GENERATE CONSTRAINT ISLANDS FOR ACTIVE SOFT BODIES */
@@ -308,7 +350,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 			if (body_islands.size() < body_island_count) {
 				body_islands.resize(body_island_count);
 			}
-			LocalVector<GodotBody3D *> &body_island = body_islands[body_island_count - 1];
+			ArenaVector<GodotBody3D *> &body_island = body_islands[body_island_count - 1];
 			body_island.clear();
 			body_island.reserve(BODY_ISLAND_SIZE_RESERVE);
 
@@ -316,7 +358,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 			if (constraint_islands.size() < island_count) {
 				constraint_islands.resize(island_count);
 			}
-			LocalVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_count - 1];
+			ArenaVector<GodotConstraint3D *> &constraint_island = constraint_islands[island_count - 1];
 			constraint_island.clear();
 			constraint_island.reserve(ISLAND_SIZE_RESERVE);
 
@@ -328,6 +370,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 			if (constraint_island.is_empty()) {
 				--island_count;
+			} else if (deterministic) {
+				constraint_island.sort_custom<ConstraintOrderComparator>();
 			}
 		}
 		sb = sb->next();
@@ -344,7 +388,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -375,11 +419,15 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
-	b = body_list->first();
-	while (b) {
-		const SelfList<GodotBody3D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n;
+	// Bodies woken up while solving are part of the active list now.
+	_gather_active_bodies(body_list);
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_integrate_velocities, nullptr, active_bodies.size(), -1, true, SNAME("Physics3DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// Kinematic bodies may deactivate here, which removes them from the active list.
+	for (GodotBody3D *body : active_bodies) {
+		body->commit_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -403,14 +451,15 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	}
 
 	all_constraints.clear();
+	active_bodies.reset();
+	body_islands.reset();
+	constraint_islands.reset();
 
 	p_space->unlock();
 	_step++;
 }
 
 GodotStep3D::GodotStep3D() {
-	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
-	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
 }
 
@@ -31,8 +31,10 @@
 #ifndef GODOT_STEP_3D_H
 #define GODOT_STEP_3D_H
 
+#include "godot_constraint_3d.h"
 #include "godot_space_3d.h"
 
+#include "core/templates/arena_vector.h"
 #include "core/templates/local_vector.h"
 
 class GodotStep3D {
@@ -40,17 +42,31 @@ class GodotStep3D {
 
 	int iterations = 0;
 	real_t delta = 0.0;
+	bool deterministic = false;
 
-	LocalVector<LocalVector<GodotBody3D *>> body_islands;
-	LocalVector<LocalVector<GodotConstraint3D *>> constraint_islands;
+	struct BodyOrderComparator {
+		_FORCE_INLINE_ bool operator()(const GodotBody3D *p_a, const GodotBody3D *p_b) const { return p_a->get_self().get_id() < p_b->get_self().get_id(); }
+	};
+
+	struct ConstraintOrderComparator {
+		_FORCE_INLINE_ bool operator()(const GodotConstraint3D *p_a, const GodotConstraint3D *p_b) const { return p_a->get_order_key() < p_b->get_order_key(); }
+	};
+
+	// Rebuilt every step from the frame arena, only valid during step().
+	ArenaVector<GodotBody3D *> active_bodies;
+	ArenaVector<ArenaVector<GodotBody3D *>> body_islands;
+	ArenaVector<ArenaVector<GodotConstraint3D *>> constraint_islands;
 	LocalVector<GodotConstraint3D *> all_constraints;
 
-	void _populate_island(GodotBody3D *p_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
-	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, LocalVector<GodotBody3D *> &p_body_island, LocalVector<GodotConstraint3D *> &p_constraint_island);
+	void _populate_island(GodotBody3D *p_body, ArenaVector<GodotBody3D *> &p_body_island, ArenaVector<GodotConstraint3D *> &p_constraint_island);
+	void _populate_island_soft_body(GodotSoftBody3D *p_soft_body, ArenaVector<GodotBody3D *> &p_body_island, ArenaVector<GodotConstraint3D *> &p_constraint_island);
+	void _gather_active_bodies(const SelfList<GodotBody3D>::List *p_body_list);
+	void _integrate_forces(uint32_t p_body_index, void *p_userdata = nullptr);
+	void _integrate_velocities(uint32_t p_body_index, void *p_userdata = nullptr);
 	void _setup_constraint(uint32_t p_constraint_index, void *p_userdata = nullptr);
-	void _pre_solve_island(LocalVector<GodotConstraint3D *> &p_constraint_island) const;
+	void _pre_solve_island(ArenaVector<GodotConstraint3D *> &p_constraint_island) const;
 	void _solve_island(uint32_t p_island_index, void *p_userdata = nullptr);
-	void _check_suspend(const LocalVector<GodotBody3D *> &p_body_island) const;
+	void _check_suspend(const ArenaVector<GodotBody3D *> &p_body_island) const;
 
 public:
 	void step(GodotSpace3D *p_space, real_t p_delta);
@@ -37,13 +37,15 @@
 static PhysicsServer3D *_createGodotPhysics3DCallback() {
 #ifdef THREADS_ENABLED
 	bool using_threads = GLOBAL_GET("physics/3d/run_on_separate_thread");
+	bool pipelined = GLOBAL_GET("physics/3d/pipelined_body_state");
 #else
 	bool using_threads = false;
+	bool pipelined = false;
 #endif
 
 	PhysicsServer3D *physics_server_3d = memnew(GodotPhysicsServer3D(using_threads));
 
-	return memnew(PhysicsServer3DWrapMT(physics_server_3d, using_threads));
+	return memnew(PhysicsServer3DWrapMT(physics_server_3d, using_threads, pipelined));
 }
 
 void initialize_godot_physics_3d_module(ModuleInitializationLevel p_level) {
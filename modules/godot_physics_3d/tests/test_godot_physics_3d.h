@@ -0,0 +1,770 @@
+/**************************************************************************/
+/*  test_godot_physics_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GODOT_PHYSICS_3D_H
+#define TEST_GODOT_PHYSICS_3D_H
+
+#include "../godot_space_3d.h"
+
+#include "core/math/geometry_3d.h"
+#include "core/math/random_pcg.h"
+#include "core/os/os.h"
+#include "servers/physics_server_3d.h"
+
+#include "tests/servers/physics_test_utils.h"
+#include "tests/test_macros.h"
+
+namespace TestGodotPhysics3D {
+
+// A space and the shapes and bodies created through it, which are all freed along with it.
+// The tests check the behavior of Godot Physics, so they return early when another 3D physics server is in use.
+struct PhysicsTestSpace {
+	PhysicsServer3D *ps = PhysicsServer3D::get_singleton();
+	RID space;
+	LocalVector<RID> shapes;
+	LocalVector<RID> objects;
+
+	bool is_godot_physics() const {
+		return Object::cast_to<GodotPhysicsDirectSpaceState3D>(ps->space_get_direct_state(space)) != nullptr;
+	}
+
+	RID add_shape(PhysicsServer3D::ShapeType p_type, const Variant &p_data) {
+		RID shape = ps->shape_create(p_type);
+		ps->shape_set_data(shape, p_data);
+		shapes.push_back(shape);
+		return shape;
+	}
+
+	// Bodies can be created outside of the space, to control the order they are added to it.
+	RID add_body(PhysicsServer3D::BodyMode p_mode, RID p_shape, const Transform3D &p_transform, bool p_in_space = true) {
+		RID body = ps->body_create();
+		ps->body_set_mode(body, p_mode);
+		ps->body_add_shape(body, p_shape);
+		ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, p_transform);
+		if (p_in_space) {
+			ps->body_set_space(body, space);
+		}
+		objects.push_back(body);
+		return body;
+	}
+
+	// Static box with its top face at y = 0.
+	RID add_floor(const Vector3 &p_half_extents, bool p_in_space = true) {
+		RID floor_shape = add_shape(PhysicsServer3D::SHAPE_BOX, p_half_extents);
+		return add_body(PhysicsServer3D::BODY_MODE_STATIC, floor_shape, Transform3D(Basis(), Vector3(0, -p_half_extents.y, 0)), p_in_space);
+	}
+
+	RID add_area(RID p_shape) {
+		RID area = ps->area_create();
+		ps->area_add_shape(area, p_shape);
+		objects.push_back(area);
+		return area;
+	}
+
+	void step(int p_steps) {
+		for (int i = 0; i < p_steps; i++) {
+			ps->step(1.0 / 60.0);
+			ps->flush_queries();
+		}
+	}
+
+	PhysicsTestSpace() {
+		space = ps->space_create();
+		ps->space_set_active(space, true);
+	}
+
+	~PhysicsTestSpace() {
+		for (const RID &object : objects) {
+			ps->free(object);
+		}
+		for (const RID &shape : shapes) {
+			ps->free(shape);
+		}
+		ps->space_set_active(space, false);
+		ps->free(space);
+	}
+};
+
+// Bumpy terrain with a few overhangs, so rays and motions go through many overlapping nodes of the trimesh tree.
+static Vector<Vector3> build_level_faces(int p_size) {
+	Vector<Vector3> faces;
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			Vector3 corners[4];
+			for (int i = 0; i < 4; i++) {
+				const int cx = x + (i & 1);
+				const int cz = z + (i >> 1);
+				corners[i] = Vector3(cx, Math::sin(cx * 0.3) * 2.0 + Math::cos(cz * 0.2) * 3.0 + ((cx * 7 + cz * 13) % 5) * 0.1, cz);
+			}
+			faces.push_back(corners[0]);
+			faces.push_back(corners[1]);
+			faces.push_back(corners[2]);
+			faces.push_back(corners[1]);
+			faces.push_back(corners[3]);
+			faces.push_back(corners[2]);
+
+			if ((x * 3 + z) % 11 == 0) {
+				const Vector3 base = corners[0] + Vector3(0, 2.5, 0);
+				faces.push_back(base);
+				faces.push_back(base + Vector3(1.5, 0.5, 0));
+				faces.push_back(base + Vector3(0, 0.5, 1.5));
+			}
+		}
+	}
+	return faces;
+}
+
+static bool brute_force_segment(const Vector<Vector3> &p_faces, const Vector3 &p_from, const Vector3 &p_to, Vector3 &r_position) {
+	const Vector3 dir = (p_to - p_from).normalized();
+	real_t closest = 1e20;
+	bool hit = false;
+	for (int i = 0; i < p_faces.size(); i += 3) {
+		Vector3 position;
+		if (Geometry3D::segment_intersects_triangle(p_from, p_to, p_faces[i], p_faces[i + 1], p_faces[i + 2], &position)) {
+			const real_t d = dir.dot(position - p_from);
+			if (d > 0 && d < closest) {
+				closest = d;
+				r_position = position;
+				hit = true;
+			}
+		}
+	}
+	return hit;
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Concave polygon shape queries") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	const int level_size = 48;
+	const Vector<Vector3> faces = build_level_faces(level_size);
+
+	Dictionary data;
+	data["faces"] = faces;
+	data["backface_collision"] = true;
+	RID shape = test_space.add_shape(PhysicsServer3D::SHAPE_CONCAVE_POLYGON, data);
+	test_space.add_body(PhysicsServer3D::BODY_MODE_STATIC, shape, Transform3D());
+
+	SUBCASE("Ray casts match a brute force search") {
+		PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(test_space.space);
+		REQUIRE(state != nullptr);
+
+		RandomPCG rng(4242);
+		int mismatches = 0;
+		int hits = 0;
+		for (int i = 0; i < 256; i++) {
+			PhysicsDirectSpaceState3D::RayParameters parameters;
+			parameters.from = Vector3(rng.randf() * level_size, 12.0 + rng.randf() * 4.0, rng.randf() * level_size);
+			if (i % 2 == 0) {
+				parameters.to = Vector3(rng.randf() * level_size, -8.0, rng.randf() * level_size);
+			} else {
+				// Grazing rays, mostly parallel to the terrain.
+				parameters.from.y = 1.0 + rng.randf() * 2.0;
+				parameters.to = parameters.from + Vector3(rng.randf() * 20.0 - 10.0, rng.randf() - 0.5, rng.randf() * 20.0 - 10.0);
+			}
+
+			PhysicsDirectSpaceState3D::RayResult result;
+			const bool hit = state->intersect_ray(parameters, result);
+
+			Vector3 expected;
+			const bool expected_hit = brute_force_segment(faces, parameters.from, parameters.to, expected);
+			if (hit != expected_hit || (hit && !result.position.is_equal_approx(expected))) {
+				mismatches++;
+			}
+			hits += hit ? 1 : 0;
+		}
+
+		CHECK(mismatches == 0);
+		CHECK(hits > 0);
+	}
+
+	SUBCASE("Character motion against the trimesh") {
+		Dictionary capsule_data;
+		capsule_data["radius"] = 0.4;
+		capsule_data["height"] = 1.8;
+		RID capsule = test_space.add_shape(PhysicsServer3D::SHAPE_CAPSULE, capsule_data);
+		RID character = test_space.add_body(PhysicsServer3D::BODY_MODE_KINEMATIC, capsule, Transform3D());
+
+		// Falling onto the terrain, as move_and_slide does when snapping to the floor.
+		PhysicsServer3D::MotionParameters fall(Transform3D(Basis(), Vector3(level_size * 0.5, 12.0, level_size * 0.5)), Vector3(0, -20.0, 0));
+		PhysicsServer3D::MotionResult fall_result;
+		CHECK(ps->body_test_motion(character, fall, &fall_result));
+		CHECK(fall_result.collision_count > 0);
+		CHECK(fall_result.collisions[0].normal.y > 0.0);
+		CHECK(fall_result.travel.y < 0.0);
+
+		// Walking far above the terrain doesn't touch it.
+		PhysicsServer3D::MotionParameters walk(Transform3D(Basis(), Vector3(2.0, 20.0, 2.0)), Vector3(level_size - 4.0, 0, level_size - 4.0));
+		CHECK_FALSE(ps->body_test_motion(character, walk));
+	}
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][SceneTree][GodotPhysics3D] Ray casts and character motion against a large trimesh") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	// About 35k triangles.
+	const int level_size = 128;
+	Dictionary data;
+	data["faces"] = build_level_faces(level_size);
+	data["backface_collision"] = true;
+	RID shape = test_space.add_shape(PhysicsServer3D::SHAPE_CONCAVE_POLYGON, data);
+	test_space.add_body(PhysicsServer3D::BODY_MODE_STATIC, shape, Transform3D());
+
+	PhysicsDirectSpaceState3D *state = ps->space_get_direct_state(test_space.space);
+	REQUIRE(state != nullptr);
+
+	RandomPCG rng(4242);
+	const int ray_count = 100000;
+	int hits = 0;
+	uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < ray_count; i++) {
+		PhysicsDirectSpaceState3D::RayParameters parameters;
+		parameters.from = Vector3(rng.randf() * level_size, 1.0 + rng.randf() * 2.0, rng.randf() * level_size);
+		if (i % 2 == 0) {
+			parameters.from.y = 12.0;
+			parameters.to = Vector3(parameters.from.x, -8.0, parameters.from.z);
+		} else {
+			parameters.to = parameters.from + Vector3(rng.randf() * 20.0 - 10.0, rng.randf() - 0.5, rng.randf() * 20.0 - 10.0);
+		}
+		PhysicsDirectSpaceState3D::RayResult result;
+		hits += state->intersect_ray(parameters, result) ? 1 : 0;
+	}
+	uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+	MESSAGE(vformat("%d rays/s, %d hits.", (int64_t)(ray_count * 1000000.0 / elapsed_usec), hits));
+
+	Dictionary capsule_data;
+	capsule_data["radius"] = 0.4;
+	capsule_data["height"] = 1.8;
+	RID capsule = test_space.add_shape(PhysicsServer3D::SHAPE_CAPSULE, capsule_data);
+	RID character = test_space.add_body(PhysicsServer3D::BODY_MODE_KINEMATIC, capsule, Transform3D());
+
+	// What move_and_slide tests for a character walking on the terrain: the walk, then the floor snap.
+	const int step_count = 10000;
+	int collisions = 0;
+	begin_usec = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < step_count; i++) {
+		const Vector3 origin(4.0 + rng.randf() * (level_size - 8.0), 6.0, 4.0 + rng.randf() * (level_size - 8.0));
+		PhysicsServer3D::MotionParameters walk(Transform3D(Basis(), origin), Vector3(rng.randf() - 0.5, -0.2, rng.randf() - 0.5) * 0.5);
+		PhysicsServer3D::MotionResult walk_result;
+		collisions += ps->body_test_motion(character, walk, &walk_result) ? 1 : 0;
+
+		PhysicsServer3D::MotionParameters snap(Transform3D(Basis(), origin + walk_result.travel), Vector3(0, -10.0, 0));
+		PhysicsServer3D::MotionResult snap_result;
+		collisions += ps->body_test_motion(character, snap, &snap_result) ? 1 : 0;
+	}
+	elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+	MESSAGE(vformat("%d move_and_slide steps/s, %d collisions.", (int64_t)(step_count * 1000000.0 / elapsed_usec), collisions));
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Batched ray and shape queries") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	test_space.add_floor(Vector3(20, 0.5, 20));
+	RID box_shape = test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(0.5, 0.5, 0.5));
+	for (int i = 0; i < 8; i++) {
+		test_space.add_body(PhysicsServer3D::BODY_MODE_STATIC, box_shape, Transform3D(Basis(), Vector3(i * 2 - 8, 0.5, i % 3)));
+	}
+
+	GodotPhysicsDirectSpaceState3D *state = Object::cast_to<GodotPhysicsDirectSpaceState3D>(ps->space_get_direct_state(test_space.space));
+	REQUIRE(state != nullptr);
+
+	const int query_count = 64;
+	RandomPCG rng(1234);
+
+	LocalVector<Vector3> from;
+	LocalVector<Vector3> to;
+	LocalVector<Transform3D> transforms;
+	for (int i = 0; i < query_count; i++) {
+		from.push_back(Vector3(rng.randf() * 20 - 10, 4, rng.randf() * 6 - 3));
+		to.push_back(from[i] + Vector3(rng.randf() * 4 - 2, -6, rng.randf() * 4 - 2));
+		transforms.push_back(Transform3D(Basis(), Vector3(rng.randf() * 20 - 10, rng.randf() * 2, rng.randf() * 6 - 3)));
+	}
+
+	PhysicsDirectSpaceState3D::ShapeParameters shape_parameters;
+	shape_parameters.shape_rid = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.75);
+
+	const int result_max = 4;
+	LocalVector<PhysicsDirectSpaceState3D::RayResult> ray_results;
+	LocalVector<PhysicsDirectSpaceState3D::ShapeResult> shape_results;
+	bool hits[query_count];
+	int result_counts[query_count];
+	ray_results.resize(query_count);
+	shape_results.resize(query_count * result_max);
+
+	SUBCASE("Batches match single queries") {
+		state->intersect_ray_batch(PhysicsDirectSpaceState3D::RayParameters(), from.ptr(), to.ptr(), query_count, ray_results.ptr(), hits);
+		state->intersect_shape_batch(shape_parameters, transforms.ptr(), query_count, shape_results.ptr(), result_max, result_counts);
+
+		int ray_mismatches = 0;
+		int shape_mismatches = 0;
+		for (int i = 0; i < query_count; i++) {
+			PhysicsDirectSpaceState3D::RayParameters ray_parameters;
+			ray_parameters.from = from[i];
+			ray_parameters.to = to[i];
+			PhysicsDirectSpaceState3D::RayResult ray_result;
+			const bool hit = state->intersect_ray(ray_parameters, ray_result);
+			if (hit != hits[i] || (hit && (ray_result.rid != ray_results[i].rid || !ray_result.position.is_equal_approx(ray_results[i].position)))) {
+				ray_mismatches++;
+			}
+
+			PhysicsDirectSpaceState3D::ShapeParameters single_parameters = shape_parameters;
+			single_parameters.transform = transforms[i];
+			PhysicsDirectSpaceState3D::ShapeResult single_results[result_max];
+			const int single_count = state->intersect_shape(single_parameters, single_results, result_max);
+			if (single_count != result_counts[i]) {
+				shape_mismatches++;
+				continue;
+			}
+			for (int j = 0; j < single_count; j++) {
+				if (single_results[j].rid != shape_results[i * result_max + j].rid || single_results[j].shape != shape_results[i * result_max + j].shape) {
+					shape_mismatches++;
+				}
+			}
+		}
+		CHECK(ray_mismatches == 0);
+		CHECK(shape_mismatches == 0);
+	}
+
+	SUBCASE("A locked space reports no results") {
+		for (int i = 0; i < query_count; i++) {
+			hits[i] = true;
+			result_counts[i] = result_max + 1;
+		}
+
+		state->space->lock();
+		ERR_PRINT_OFF;
+		state->intersect_ray_batch(PhysicsDirectSpaceState3D::RayParameters(), from.ptr(), to.ptr(), query_count, ray_results.ptr(), hits);
+		state->intersect_shape_batch(shape_parameters, transforms.ptr(), query_count, shape_results.ptr(), result_max, result_counts);
+
+		Ref<PhysicsRayQueryParameters3D> ray_query;
+		ray_query.instantiate();
+		PackedVector3Array from_array;
+		PackedVector3Array to_array;
+		for (int i = 0; i < query_count; i++) {
+			from_array.push_back(from[i]);
+			to_array.push_back(to[i]);
+		}
+		Dictionary ray_batch = state->call("intersect_ray_batch", ray_query, from_array, to_array);
+		ERR_PRINT_ON;
+		state->space->unlock();
+
+		int reported = 0;
+		for (int i = 0; i < query_count; i++) {
+			reported += (hits[i] ? 1 : 0) + result_counts[i];
+		}
+		CHECK(reported == 0);
+
+		const PackedByteArray ray_batch_hits = ray_batch["hit"];
+		REQUIRE(ray_batch_hits.size() == query_count);
+		CHECK(ray_batch_hits.count(1) == 0);
+	}
+
+	SUBCASE("An invalid shape reports no results") {
+		for (int i = 0; i < query_count; i++) {
+			result_counts[i] = result_max + 1;
+		}
+
+		shape_parameters.shape_rid = RID();
+		ERR_PRINT_OFF;
+		state->intersect_shape_batch(shape_parameters, transforms.ptr(), query_count, shape_results.ptr(), result_max, result_counts);
+
+		Ref<PhysicsShapeQueryParameters3D> shape_query;
+		shape_query.instantiate();
+		TypedArray<Transform3D> transform_array;
+		for (int i = 0; i < query_count; i++) {
+			transform_array.push_back(transforms[i]);
+		}
+		Dictionary shape_batch = state->call("intersect_shape_batch", shape_query, transform_array, result_max);
+		ERR_PRINT_ON;
+
+		int reported = 0;
+		for (int i = 0; i < query_count; i++) {
+			reported += result_counts[i];
+		}
+		CHECK(reported == 0);
+
+		const PackedInt32Array queries = shape_batch["query"];
+		CHECK(queries.is_empty());
+	}
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Box stack with reused contacts") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	// Few iterations, warm starting and the persistent contacts are what keep the stack up.
+	ps->space_set_param(test_space.space, PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS, 8);
+	ps->space_set_param(test_space.space, PhysicsServer3D::SPACE_PARAM_CONTACT_REUSE_THRESHOLD, 0.002);
+
+	test_space.add_floor(Vector3(10, 0.5, 10));
+	RID box_shape = test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(0.5, 0.5, 0.5));
+
+	const int box_count = 3;
+	RID boxes[box_count];
+	for (int i = 0; i < box_count; i++) {
+		boxes[i] = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, box_shape, Transform3D(Basis(), Vector3(0, 0.5 + i * 1.0, 0)));
+	}
+
+	test_space.step(180);
+
+	for (int i = 0; i < box_count; i++) {
+		Transform3D xform = ps->body_get_state(boxes[i], PhysicsServer3D::BODY_STATE_TRANSFORM);
+		CHECK(Math::abs(xform.origin.x) < 0.05);
+		CHECK(Math::abs(xform.origin.z) < 0.05);
+		CHECK(Math::abs(xform.origin.y - (0.5 + i * 1.0)) < 0.1);
+		CHECK(xform.basis.get_column(1).dot(Vector3(0, 1, 0)) > 0.99);
+	}
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Many moving bodies are paired with the floor") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	test_space.add_floor(Vector3(20, 0.5, 20));
+
+	// Enough bodies moving every step for the broadphase to pair them on several threads.
+	RID sphere_shape = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.25);
+
+	const int grid_size = 20;
+	LocalVector<RID> spheres;
+	for (int z = 0; z < grid_size; z++) {
+		for (int x = 0; x < grid_size; x++) {
+			RID sphere = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, sphere_shape, Transform3D(Basis(), Vector3(x - grid_size / 2, 1.0 + ((x + z) % 3) * 0.5, z - grid_size / 2)));
+			ps->body_set_state(sphere, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0, -5, 0));
+			spheres.push_back(sphere);
+		}
+	}
+
+	test_space.step(60);
+
+	int below_floor = 0;
+	for (const RID &sphere : spheres) {
+		Transform3D xform = ps->body_get_state(sphere, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		if (xform.origin.y < 0.1) {
+			below_floor++;
+		}
+	}
+	CHECK(below_floor == 0);
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Fast body doesn't tunnel with continuous collision detection") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	// Two thin walls leave a slot at x = 10 that is narrower than the sphere. A ray cast from the
+	// front of the sphere goes through the slot, so only the edges of the walls can stop it.
+	RID wall_shape = test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(0.05, 1, 1));
+	test_space.add_body(PhysicsServer3D::BODY_MODE_STATIC, wall_shape, Transform3D(Basis(), Vector3(10, 1.3, 0)));
+	test_space.add_body(PhysicsServer3D::BODY_MODE_STATIC, wall_shape, Transform3D(Basis(), Vector3(10, -1.3, 0)));
+
+	// Moves 5 units per step, from x = 2 to 7 and then 12, so it is never overlapping the walls at
+	// the end of a step.
+	RID sphere_shape = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.5);
+	RID sphere = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, sphere_shape, Transform3D(Basis(), Vector3(2, 0, 0)));
+	ps->body_set_param(sphere, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	ps->body_set_enable_continuous_collision_detection(sphere, true);
+	ps->body_set_state(sphere, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(300, 0, 0));
+
+	test_space.step(30);
+
+	// Stuck against the edges of the slot, the center can't get closer than 0.4 to them.
+	Transform3D xform = ps->body_get_state(sphere, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK(xform.origin.x < 9.6);
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][SceneTree][GodotPhysics3D] Fast projectiles with and without continuous collision detection") {
+	const int projectile_count = 5000;
+	const int step_count = 30;
+
+	for (int ccd = 0; ccd < 2; ccd++) {
+		PhysicsTestSpace test_space;
+		if (!test_space.is_godot_physics()) {
+			return;
+		}
+		PhysicsServer3D *ps = test_space.ps;
+
+		// A thin wall in front of a grid of small spheres, which move 5 units per step towards it.
+		RID wall_shape = test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(0.05, 15, 30));
+		test_space.add_body(PhysicsServer3D::BODY_MODE_STATIC, wall_shape, Transform3D(Basis(), Vector3(20, 12.5, 25)));
+
+		RID sphere_shape = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.1);
+		LocalVector<RID> projectiles;
+		for (int i = 0; i < projectile_count; i++) {
+			RID projectile = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, sphere_shape, Transform3D(Basis(), Vector3(0, (i % 50) * 0.5, (i / 50) * 0.5)));
+			ps->body_set_param(projectile, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+			ps->body_set_enable_continuous_collision_detection(projectile, ccd == 1);
+			ps->body_set_state(projectile, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(300, 0, 0));
+			projectiles.push_back(projectile);
+		}
+
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		test_space.step(step_count);
+		const uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+		int tunneled = 0;
+		for (const RID &projectile : projectiles) {
+			const Transform3D xform = ps->body_get_state(projectile, PhysicsServer3D::BODY_STATE_TRANSFORM);
+			tunneled += xform.origin.x > 20.0 ? 1 : 0;
+		}
+		MESSAGE(vformat("Continuous collision detection %s: %.3f ms per step, %d of %d projectiles went through the wall.", ccd == 1 ? "on" : "off", elapsed_usec / 1000.0 / step_count, tunneled, projectile_count));
+	}
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Speculative contacts don't solve stale contacts") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+	ps->space_set_param(test_space.space, PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_SEPARATION, 0.05);
+	ps->space_set_param(test_space.space, PhysicsServer3D::SPACE_PARAM_CONTACT_MAX_ALLOWED_PENETRATION, 0.01);
+
+	// The floor ends at x = 1.
+	test_space.add_floor(Vector3(1, 0.5, 1));
+
+	// A small sphere resting right before the end of the floor.
+	RID sphere_shape = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.05);
+	RID sphere = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, sphere_shape, Transform3D(Basis(), Vector3(0.995, 0.05, 0)));
+	ps->body_set_param(sphere, PhysicsServer3D::BODY_PARAM_FRICTION, 0.0);
+	ps->body_set_enable_continuous_collision_detection(sphere, true);
+
+	test_space.step(20);
+
+	// Moving it past the end of the floor by less than the max separation keeps its contacts with
+	// the top face, but the shapes don't touch anymore. Thrown down, it only gets a speculative
+	// contact with the edge of the floor.
+	Transform3D xform = ps->body_get_state(sphere, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	REQUIRE(xform.origin.y > 0.035);
+	xform.origin.x = 1.035;
+	ps->body_set_state(sphere, PhysicsServer3D::BODY_STATE_TRANSFORM, xform);
+	ps->body_set_state(sphere, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0, -4, 0));
+
+	test_space.step(1);
+
+	// The edge only slows it down and pushes it away. Solving the contacts with the top face would
+	// hold it up as if it was still on the floor.
+	Vector3 velocity = ps->body_get_state(sphere, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+	CHECK(velocity.y < -1.0);
+	CHECK(velocity.x > 0.0);
+}
+
+struct AreaMonitorRecorder {
+	static inline int event_calls = 0;
+	static inline int batch_calls = 0;
+	static inline int last_status = -1;
+	static inline PackedInt64Array body_events;
+
+	static void body_event(int p_status, const RID &p_body, ObjectID p_instance, int p_body_shape, int p_area_shape) {
+		event_calls++;
+		last_status = p_status;
+	}
+
+	static void batch(const PackedInt64Array &p_body_events, const PackedInt64Array &p_area_events) {
+		batch_calls++;
+		body_events = p_body_events;
+	}
+};
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Area monitor events are batched") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	RID area = test_space.add_area(test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(2, 2, 2)));
+	ps->area_set_monitor_callback(area, callable_mp_static(&AreaMonitorRecorder::body_event));
+	ps->area_set_monitor_batch_callback(area, callable_mp_static(&AreaMonitorRecorder::batch));
+	ps->area_set_space(area, test_space.space);
+
+	RID sphere_shape = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.2);
+
+	const int body_count = 3;
+	RID bodies[body_count];
+	for (int i = 0; i < body_count; i++) {
+		bodies[i] = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, sphere_shape, Transform3D(Basis(), Vector3(i - 1, 0, 0)));
+	}
+
+	AreaMonitorRecorder::event_calls = 0;
+	AreaMonitorRecorder::batch_calls = 0;
+
+	// All the bodies entering on the same step are reported with a single call.
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::batch_calls == 1);
+	CHECK(AreaMonitorRecorder::event_calls == 0);
+	REQUIRE(AreaMonitorRecorder::body_events.size() == body_count * 5);
+	for (int i = 0; i < body_count; i++) {
+		CHECK(AreaMonitorRecorder::body_events[i * 5] == PhysicsServer3D::AREA_BODY_ADDED);
+	}
+
+	// Nothing entered or exited, so no call.
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::batch_calls == 1);
+
+	ps->body_set_state(bodies[0], PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(10, 0, 0)));
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::batch_calls == 2);
+	REQUIRE(AreaMonitorRecorder::body_events.size() == 5);
+	CHECK(AreaMonitorRecorder::body_events[0] == PhysicsServer3D::AREA_BODY_REMOVED);
+	CHECK(RID::from_uint64(AreaMonitorRecorder::body_events[1]) == bodies[0]);
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Cached area overlaps are tested again after changes") {
+	PhysicsTestSpace test_space;
+	if (!test_space.is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_space.ps;
+
+	RID area = test_space.add_area(test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(1, 1, 1)));
+	ps->area_set_monitor_callback(area, callable_mp_static(&AreaMonitorRecorder::body_event));
+	ps->area_set_space(area, test_space.space);
+
+	// Kept awake, so its pair with the area is set up on every step.
+	RID sphere_shape = test_space.add_shape(PhysicsServer3D::SHAPE_SPHERE, 0.5);
+	RID body = test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, sphere_shape, Transform3D());
+	ps->body_set_param(body, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_CAN_SLEEP, false);
+
+	AreaMonitorRecorder::event_calls = 0;
+	AreaMonitorRecorder::last_status = -1;
+
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::event_calls == 1);
+	CHECK(AreaMonitorRecorder::last_status == PhysicsServer3D::AREA_BODY_ADDED);
+
+	test_space.step(2);
+	CHECK(AreaMonitorRecorder::event_calls == 1);
+
+	// Next to a corner of the area, the shapes don't touch but their AABBs still overlap, so the
+	// pair is kept and only the overlap test can tell that the body left.
+	const Transform3D corner_xform(Basis(), Vector3(1.3, 1.3, 1.3));
+	ps->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, corner_xform);
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::event_calls == 2);
+	CHECK(AreaMonitorRecorder::last_status == PhysicsServer3D::AREA_BODY_REMOVED);
+
+	test_space.step(2);
+	CHECK(AreaMonitorRecorder::event_calls == 2);
+
+	// Neither side moves, but the bigger sphere reaches into the area.
+	ps->shape_set_data(sphere_shape, 0.6);
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::event_calls == 3);
+	CHECK(AreaMonitorRecorder::last_status == PhysicsServer3D::AREA_BODY_ADDED);
+
+	// Same for the transform of the shape in the body.
+	ps->body_set_shape_transform(body, 0, Transform3D(Basis(), Vector3(0.2, 0.2, 0.2)));
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::event_calls == 4);
+	CHECK(AreaMonitorRecorder::last_status == PhysicsServer3D::AREA_BODY_REMOVED);
+
+	ps->body_set_shape_transform(body, 0, Transform3D());
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::event_calls == 5);
+	CHECK(AreaMonitorRecorder::last_status == PhysicsServer3D::AREA_BODY_ADDED);
+
+	// And for the transform of the area.
+	ps->area_set_transform(area, Transform3D(Basis(), Vector3(-0.2, -0.2, -0.2)));
+	test_space.step(1);
+	CHECK(AreaMonitorRecorder::event_calls == 6);
+	CHECK(AreaMonitorRecorder::last_status == PhysicsServer3D::AREA_BODY_REMOVED);
+}
+
+// A pile of boxes that topples onto a floor. Bodies are added to the space in the given order, which
+// changes the order they are activated and paired in.
+static void build_toppling_pile(PhysicsTestSpace &p_test_space, bool p_reverse_order, LocalVector<RID> &r_bodies) {
+	PhysicsServer3D *ps = p_test_space.ps;
+
+	r_bodies.push_back(p_test_space.add_floor(Vector3(20, 0.5, 20), false));
+
+	RID box_shape = p_test_space.add_shape(PhysicsServer3D::SHAPE_BOX, Vector3(0.5, 0.5, 0.5));
+	for (int i = 0; i < 24; i++) {
+		const Vector3 origin((i % 3) * 1.05 + (i / 9) * 0.3, 0.5 + (i / 3) * 1.02, ((i / 3) % 3) * 0.2);
+		RID box = p_test_space.add_body(PhysicsServer3D::BODY_MODE_RIGID, box_shape, Transform3D(Basis(Vector3(0, 1, 0), i * 0.05), origin), false);
+		ps->body_add_constant_central_force(box, Vector3(0, -9.8, 0));
+		r_bodies.push_back(box);
+	}
+
+	for (uint32_t i = 0; i < r_bodies.size(); i++) {
+		ps->body_set_space(r_bodies[p_reverse_order ? r_bodies.size() - 1 - i : i], p_test_space.space);
+	}
+}
+
+TEST_CASE("[SceneTree][GodotPhysics3D] Deterministic spaces don't depend on their history") {
+	// Both spaces hold the same pile, but their bodies are activated and paired in opposite orders.
+	// The islands are solved on worker threads.
+	PhysicsTestSpace test_spaces[2];
+	if (!test_spaces[0].is_godot_physics()) {
+		return;
+	}
+	PhysicsServer3D *ps = test_spaces[0].ps;
+
+	LocalVector<RID> bodies[2];
+	for (int i = 0; i < 2; i++) {
+		ps->space_set_param(test_spaces[i].space, PhysicsServer3D::SPACE_PARAM_DETERMINISTIC, 1);
+		build_toppling_pile(test_spaces[i], i == 1, bodies[i]);
+	}
+	CHECK(ps->space_get_param(test_spaces[0].space, PhysicsServer3D::SPACE_PARAM_DETERMINISTIC) == 1);
+
+	for (int i = 0; i < 1000; i++) {
+		ps->step(1.0 / 60.0);
+	}
+
+	CHECK(PhysicsTestUtils::hash_body_states<PhysicsServer3D>(bodies[0]) == PhysicsTestUtils::hash_body_states<PhysicsServer3D>(bodies[1]));
+
+	// Sanity check that the pile actually moved.
+	const Transform3D top = ps->body_get_state(bodies[0][bodies[0].size() - 1], PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK(top.origin.y < 0.5 + 7 * 1.02);
+}
+
+} // namespace TestGodotPhysics3D
+
+#endif // TEST_GODOT_PHYSICS_3D_H
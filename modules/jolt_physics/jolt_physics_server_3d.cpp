@@ -492,6 +492,13 @@ void JoltPhysicsServer3D::area_set_area_monitor_callback(RID p_area, const Calla
 	area->set_area_monitor_callback(p_callback);
 }
 
+void JoltPhysicsServer3D::area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {
+	JoltArea3D *area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_monitor_batch_callback(p_callback);
+}
+
 void JoltPhysicsServer3D::area_set_ray_pickable(RID p_area, bool p_enable) {
 	JoltArea3D *area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
@@ -1616,7 +1623,25 @@ bool JoltPhysicsServer3D::is_flushing_queries() const {
 }
 
 int JoltPhysicsServer3D::get_process_info(ProcessInfo p_process_info) {
-	return 0;
+	switch (p_process_info) {
+		case INFO_TEMP_MEMORY_PEAK: {
+			uint64_t peak = 0;
+			for (const JoltSpace3D *space : active_spaces) {
+				peak += space->get_temp_memory_peak();
+			}
+			return (int)MIN(peak, (uint64_t)INT32_MAX);
+		}
+		case INFO_TEMP_MEMORY_CAPACITY: {
+			uint64_t capacity = 0;
+			for (const JoltSpace3D *space : active_spaces) {
+				capacity += space->get_temp_memory_capacity();
+			}
+			return (int)MIN(capacity, (uint64_t)INT32_MAX);
+		}
+		default: {
+			return 0;
+		}
+	}
 }
 
 void JoltPhysicsServer3D::free_space(JoltSpace3D *p_space) {
@@ -119,11 +119,19 @@ bool JoltArea3D::_remove_shape_pair(Overlap &p_overlap, const JPH::SubShapeID &p
 	return true;
 }
 
-void JoltArea3D::_flush_events(OverlapsById &p_objects, const Callable &p_callback) {
+void JoltArea3D::_flush_events(OverlapsById &p_objects, const Callable &p_callback, PackedInt64Array *r_batched_events) {
 	for (OverlapsById::Iterator E = p_objects.begin(); E;) {
 		Overlap &overlap = E->value;
 
-		if (p_callback.is_valid()) {
+		if (p_callback.is_valid() && r_batched_events != nullptr) {
+			for (ShapeIndexPair &shape_indices : overlap.pending_removed) {
+				r_batched_events->append_array({ PhysicsServer3D::AREA_BODY_REMOVED, int64_t(overlap.rid.get_id()), int64_t(overlap.instance_id), shape_indices.other, shape_indices.self });
+			}
+
+			for (ShapeIndexPair &shape_indices : overlap.pending_added) {
+				r_batched_events->append_array({ PhysicsServer3D::AREA_BODY_ADDED, int64_t(overlap.rid.get_id()), int64_t(overlap.instance_id), shape_indices.other, shape_indices.self });
+			}
+		} else if (p_callback.is_valid()) {
 			for (ShapeIndexPair &shape_indices : overlap.pending_removed) {
 				_report_event(p_callback, PhysicsServer3D::AREA_BODY_REMOVED, overlap.rid, overlap.instance_id, shape_indices.other, shape_indices.self);
 			}
@@ -166,6 +174,22 @@ void JoltArea3D::_report_event(const Callable &p_callback, PhysicsServer3D::Area
 	}
 }
 
+void JoltArea3D::_report_batched_events(const PackedInt64Array &p_body_events, const PackedInt64Array &p_area_events) const {
+	ERR_FAIL_COND(!monitor_batch_callback.is_valid());
+
+	const Variant arg1 = p_body_events;
+	const Variant arg2 = p_area_events;
+	const Variant *args[2] = { &arg1, &arg2 };
+
+	Callable::CallError ce;
+	Variant ret;
+	monitor_batch_callback.callp(args, 2, ret, ce);
+
+	if (unlikely(ce.error != Callable::CallError::CALL_OK)) {
+		ERR_PRINT_ONCE(vformat("Failed to call area monitor batch callback for '%s'. It returned the following error: '%s'.", to_string(), Variant::get_callable_error_text(monitor_batch_callback, args, 2, ce)));
+	}
+}
+
 void JoltArea3D::_notify_body_entered(const JPH::BodyID &p_body_id) {
 	const JoltReadableBody3D jolt_body = space->read_body(p_body_id);
 
@@ -660,6 +684,18 @@ void JoltArea3D::area_exited(const JPH::BodyID &p_body_id) {
 }
 
 void JoltArea3D::call_queries(JPH::Body &p_jolt_body) {
-	_flush_events(bodies_by_id, body_monitor_callback);
-	_flush_events(areas_by_id, area_monitor_callback);
+	if (!monitor_batch_callback.is_valid()) {
+		_flush_events(bodies_by_id, body_monitor_callback);
+		_flush_events(areas_by_id, area_monitor_callback);
+		return;
+	}
+
+	PackedInt64Array body_events;
+	PackedInt64Array area_events;
+	_flush_events(bodies_by_id, body_monitor_callback, &body_events);
+	_flush_events(areas_by_id, area_monitor_callback, &area_events);
+
+	if (!body_events.is_empty() || !area_events.is_empty()) {
+		_report_batched_events(body_events, area_events);
+	}
 }
@@ -96,6 +96,7 @@ private:
 
 	Callable body_monitor_callback;
 	Callable area_monitor_callback;
+	Callable monitor_batch_callback;
 
 	float priority = 0.0f;
 	float gravity = 9.8f;
@@ -120,9 +121,10 @@ private:
 	void _add_shape_pair(Overlap &p_overlap, const JPH::BodyID &p_body_id, const JPH::SubShapeID &p_other_shape_id, const JPH::SubShapeID &p_self_shape_id);
 	bool _remove_shape_pair(Overlap &p_overlap, const JPH::SubShapeID &p_other_shape_id, const JPH::SubShapeID &p_self_shape_id);
 
-	void _flush_events(OverlapsById &p_objects, const Callable &p_callback);
+	void _flush_events(OverlapsById &p_objects, const Callable &p_callback, PackedInt64Array *r_batched_events = nullptr);
 
 	void _report_event(const Callable &p_callback, PhysicsServer3D::AreaBodyStatus p_status, const RID &p_other_rid, ObjectID p_other_instance_id, int p_other_shape_index, int p_self_shape_index) const;
+	void _report_batched_events(const PackedInt64Array &p_body_events, const PackedInt64Array &p_area_events) const;
 
 	void _notify_body_entered(const JPH::BodyID &p_body_id);
 	void _notify_body_exited(const JPH::BodyID &p_body_id);
@@ -160,6 +162,8 @@ public:
 	bool has_area_monitor_callback() const { return area_monitor_callback.is_valid(); }
 	void set_area_monitor_callback(const Callable &p_callback);
 
+	void set_monitor_batch_callback(const Callable &p_callback) { monitor_batch_callback = p_callback; }
+
 	bool is_monitorable() const { return monitorable; }
 	void set_monitorable(bool p_monitorable);
 
@@ -39,13 +39,15 @@
 PhysicsServer3D *create_jolt_physics_server() {
 #ifdef THREADS_ENABLED
 	bool run_on_separate_thread = GLOBAL_GET("physics/3d/run_on_separate_thread");
+	bool pipelined_body_state = GLOBAL_GET("physics/3d/pipelined_body_state");
 #else
 	bool run_on_separate_thread = false;
+	bool pipelined_body_state = false;
 #endif
 
 	JoltPhysicsServer3D *physics_server = memnew(JoltPhysicsServer3D(run_on_separate_thread));
 
-	return memnew(PhysicsServer3DWrapMT(physics_server, run_on_separate_thread));
+	return memnew(PhysicsServer3DWrapMT(physics_server, run_on_separate_thread, pipelined_body_state));
 }
 
 void initialize_jolt_physics_module(ModuleInitializationLevel p_level) {
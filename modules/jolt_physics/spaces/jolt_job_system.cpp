@@ -104,6 +104,7 @@ void JoltJobSystem::Job::queue() {
 	// thread-safe lookup every time we create/queue a task. So instead we use the same cached description for all of them.
 	static const String task_name("Jolt Physics");
 
+	// Queued as high priority, so the step isn't held up behind low priority tasks, like threaded resource loads.
 	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, true, task_name);
 }
 
@@ -43,6 +43,8 @@
 #include "jolt_query_filter_3d.h"
 #include "jolt_space_3d.h"
 
+#include "core/object/worker_thread_pool.h"
+
 #include "Jolt/Geometry/GJKClosestPoint.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyFilter.h"
@@ -468,15 +470,11 @@ JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D *p_spac
 		space(p_space) {
 }
 
-bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
-	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
-
-	space->try_optimize();
-
+bool JoltPhysicsDirectSpaceState3D::_intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result) {
 	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude, p_parameters.pick_ray);
 
-	const JPH::RVec3 from = to_jolt_r(p_parameters.from);
-	const JPH::RVec3 to = to_jolt_r(p_parameters.to);
+	const JPH::RVec3 from = to_jolt_r(p_from);
+	const JPH::RVec3 to = to_jolt_r(p_to);
 	const JPH::Vec3 vector = JPH::Vec3(to - from);
 	const JPH::RRayCast ray(from, vector);
 
@@ -532,6 +530,14 @@ bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_paramet
 	return true;
 }
 
+bool JoltPhysicsDirectSpaceState3D::intersect_ray(const RayParameters &p_parameters, RayResult &r_result) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_ray must not be called while the physics space is being stepped.");
+
+	space->try_optimize();
+
+	return _intersect_ray(p_parameters, p_parameters.from, p_parameters.to, r_result);
+}
+
 int JoltPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_point must not be called while the physics space is being stepped.");
 
@@ -572,30 +578,16 @@ int JoltPhysicsDirectSpaceState3D::intersect_point(const PointParameters &p_para
 	return hit_count;
 }
 
-int JoltPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
-	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_shape must not be called while the physics space is being stepped.");
-
-	if (p_result_max == 0) {
-		return 0;
-	}
-
-	space->try_optimize();
-
-	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
-	ERR_FAIL_NULL_V(shape, 0);
-
-	const JPH::ShapeRefC jolt_shape = shape->try_build();
-	ERR_FAIL_NULL_V(jolt_shape, 0);
-
-	Transform3D transform = p_parameters.transform;
+int JoltPhysicsDirectSpaceState3D::_intersect_shape(const ShapeParameters &p_parameters, const JPH::Shape *p_jolt_shape, const Transform3D &p_transform, ShapeResult *r_results, int p_result_max) {
+	Transform3D transform = p_transform;
 	JOLT_ENSURE_SCALE_NOT_ZERO(transform, "intersect_shape was passed an invalid transform.");
 
 	Vector3 scale = transform.basis.get_scale();
-	JOLT_ENSURE_SCALE_VALID(jolt_shape, scale, "intersect_shape was passed an invalid transform.");
+	JOLT_ENSURE_SCALE_VALID(p_jolt_shape, scale, "intersect_shape was passed an invalid transform.");
 
 	transform.basis.orthonormalize();
 
-	const Vector3 com_scaled = to_godot(jolt_shape->GetCenterOfMass());
+	const Vector3 com_scaled = to_godot(p_jolt_shape->GetCenterOfMass());
 	const Transform3D transform_com = transform.translated_local(com_scaled);
 
 	JPH::CollideShapeSettings settings;
@@ -603,7 +595,7 @@ int JoltPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_para
 
 	const JoltQueryFilter3D query_filter(*this, p_parameters.collision_mask, p_parameters.collide_with_bodies, p_parameters.collide_with_areas, p_parameters.exclude);
 	JoltQueryCollectorAnyMulti<JPH::CollideShapeCollector, 32> collector(p_result_max);
-	_collide_shape_queries(jolt_shape, to_jolt(scale), to_jolt_r(transform_com), settings, to_jolt_r(transform_com.origin), collector, query_filter, query_filter, query_filter);
+	_collide_shape_queries(p_jolt_shape, to_jolt(scale), to_jolt_r(transform_com), settings, to_jolt_r(transform_com.origin), collector, query_filter, query_filter, query_filter);
 
 	const int hit_count = collector.get_hit_count();
 
@@ -632,6 +624,90 @@ int JoltPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_para
 	return hit_count;
 }
 
+int JoltPhysicsDirectSpaceState3D::intersect_shape(const ShapeParameters &p_parameters, ShapeResult *r_results, int p_result_max) {
+	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "intersect_shape must not be called while the physics space is being stepped.");
+
+	if (p_result_max == 0) {
+		return 0;
+	}
+
+	space->try_optimize();
+
+	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
+	ERR_FAIL_NULL_V(shape, 0);
+
+	const JPH::ShapeRefC jolt_shape = shape->try_build();
+	ERR_FAIL_NULL_V(jolt_shape, 0);
+
+	return _intersect_shape(p_parameters, jolt_shape, p_parameters.transform, r_results, p_result_max);
+}
+
+void JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_task(uint32_t p_index, RayBatch *p_batch) {
+	p_batch->hits[p_index] = _intersect_ray(*p_batch->parameters, p_batch->from[p_index], p_batch->to[p_index], p_batch->results[p_index]);
+}
+
+void JoltPhysicsDirectSpaceState3D::_intersect_shape_batch_task(uint32_t p_index, ShapeBatch *p_batch) {
+	p_batch->result_counts[p_index] = _intersect_shape(*p_batch->parameters, p_batch->jolt_shape, p_batch->transforms[p_index], &p_batch->results[p_index * p_batch->result_max], p_batch->result_max);
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	for (int i = 0; i < p_count; i++) {
+		r_hits[i] = false;
+	}
+
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_ray_batch must not be called while the physics space is being stepped.");
+
+	if (p_count <= 0) {
+		return;
+	}
+
+	// Jolt's narrow phase queries can run from several threads at once, as long as nothing is
+	// modified meanwhile. Optimizing the broad phase is a modification, so it's done upfront.
+	space->try_optimize();
+
+	RayBatch batch;
+	batch.parameters = &p_parameters;
+	batch.from = p_from;
+	batch.to = p_to;
+	batch.results = r_results;
+	batch.hits = r_hits;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_intersect_ray_batch_task, &batch, p_count, -1, true, SNAME("JoltIntersectRayBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
+void JoltPhysicsDirectSpaceState3D::intersect_shape_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	for (int i = 0; i < p_count; i++) {
+		r_result_counts[i] = 0;
+	}
+
+	ERR_FAIL_COND_MSG(space->is_stepping(), "intersect_shape_batch must not be called while the physics space is being stepped.");
+
+	if (p_count <= 0 || p_result_max <= 0) {
+		return;
+	}
+
+	space->try_optimize();
+
+	JoltShape3D *shape = JoltPhysicsServer3D::get_singleton()->get_shape(p_parameters.shape_rid);
+	ERR_FAIL_NULL(shape);
+
+	// Building the shape isn't thread-safe, so all the queries share the one built here.
+	const JPH::ShapeRefC jolt_shape = shape->try_build();
+	ERR_FAIL_NULL(jolt_shape);
+
+	ShapeBatch batch;
+	batch.parameters = &p_parameters;
+	batch.jolt_shape = jolt_shape;
+	batch.transforms = p_transforms;
+	batch.results = r_results;
+	batch.result_max = p_result_max;
+	batch.result_counts = r_result_counts;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &JoltPhysicsDirectSpaceState3D::_intersect_shape_batch_task, &batch, p_count, -1, true, SNAME("JoltIntersectShapeBatch"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+}
+
 bool JoltPhysicsDirectSpaceState3D::cast_motion(const ShapeParameters &p_parameters, real_t &r_closest_safe, real_t &r_closest_unsafe, ShapeRestInfo *r_info) {
 	ERR_FAIL_COND_V_MSG(space->is_stepping(), false, "cast_motion must not be called while the physics space is being stepped.");
 	ERR_FAIL_COND_V_MSG(r_info != nullptr, false, "Providing rest info as part of cast_motion is not supported when using Jolt Physics.");
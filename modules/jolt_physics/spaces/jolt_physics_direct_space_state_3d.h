@@ -62,6 +62,29 @@ class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3D {
 
 	int _try_get_face_index(const JPH::Body &p_body, const JPH::SubShapeID &p_sub_shape_id);
 
+	struct RayBatch {
+		const RayParameters *parameters = nullptr;
+		const Vector3 *from = nullptr;
+		const Vector3 *to = nullptr;
+		RayResult *results = nullptr;
+		bool *hits = nullptr;
+	};
+
+	struct ShapeBatch {
+		const ShapeParameters *parameters = nullptr;
+		const JPH::Shape *jolt_shape = nullptr;
+		const Transform3D *transforms = nullptr;
+		ShapeResult *results = nullptr;
+		int result_max = 0;
+		int *result_counts = nullptr;
+	};
+
+	bool _intersect_ray(const RayParameters &p_parameters, const Vector3 &p_from, const Vector3 &p_to, RayResult &r_result);
+	int _intersect_shape(const ShapeParameters &p_parameters, const JPH::Shape *p_jolt_shape, const Transform3D &p_transform, ShapeResult *r_results, int p_result_max);
+
+	void _intersect_ray_batch_task(uint32_t p_index, RayBatch *p_batch);
+	void _intersect_shape_batch_task(uint32_t p_index, ShapeBatch *p_batch);
+
 	void _generate_manifold(const JPH::CollideShapeResult &p_hit, JPH::ContactPoints &r_contact_points1, JPH::ContactPoints &r_contact_points2 JPH_IF_DEBUG_RENDERER(, JPH::RVec3Arg p_center_of_mass)) const;
 
 	void _collide_shape_queries(const JPH::Shape *p_shape, JPH::Vec3Arg p_scale, JPH::RMat44Arg p_transform_com, const JPH::CollideShapeSettings &p_settings, JPH::RVec3Arg p_base_offset, JPH::CollideShapeCollector &p_collector, const JPH::BroadPhaseLayerFilter &p_broad_phase_layer_filter = JPH::BroadPhaseLayerFilter(), const JPH::ObjectLayerFilter &p_object_layer_filter = JPH::ObjectLayerFilter(), const JPH::BodyFilter &p_body_filter = JPH::BodyFilter(), const JPH::ShapeFilter &p_shape_filter = JPH::ShapeFilter()) const;
@@ -79,6 +102,9 @@ public:
 	virtual bool rest_info(const ShapeParameters &p_parameters, ShapeRestInfo *r_info) override;
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, Vector3 p_point) const override;
 
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) override;
+	virtual void intersect_shape_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) override;
+
 	bool body_test_motion(const JoltBody3D &p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result) const;
 
 	JoltSpace3D &get_space() const { return *space; }
@@ -59,6 +59,7 @@ constexpr double DEFAULT_CONTACT_DEFAULT_BIAS = 0.8;
 constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
+constexpr double DEFAULT_CONTACT_REUSE_THRESHOLD = 0.0;
 
 } // namespace
 
@@ -205,6 +206,8 @@ void JoltSpace3D::step(float p_step) {
 				JoltProjectSettings::get_max_contact_constraints()));
 	}
 
+	temp_allocator->end_step();
+
 	_post_step(p_step);
 
 	bodies_added_since_optimizing = 0;
@@ -274,6 +277,13 @@ double JoltSpace3D::get_param(PhysicsServer3D::SpaceParameter p_param) const {
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
 			return DEFAULT_SOLVER_ITERATIONS;
 		}
+		case PhysicsServer3D::SPACE_PARAM_CONTACT_REUSE_THRESHOLD: {
+			return DEFAULT_CONTACT_REUSE_THRESHOLD;
+		}
+		case PhysicsServer3D::SPACE_PARAM_DETERMINISTIC: {
+			// Jolt Physics is deterministic regardless of the number of threads.
+			return 1.0;
+		}
 		default: {
 			ERR_FAIL_V_MSG(0.0, vformat("Unhandled space parameter: '%d'. This should not happen. Please report this.", p_param));
 		}
@@ -306,6 +316,14 @@ void JoltSpace3D::set_param(PhysicsServer3D::SpaceParameter p_param, double p_va
 		case PhysicsServer3D::SPACE_PARAM_SOLVER_ITERATIONS: {
 			WARN_PRINT("Space-specific solver iterations is not supported when using Jolt Physics. Any such value will be ignored.");
 		} break;
+		case PhysicsServer3D::SPACE_PARAM_CONTACT_REUSE_THRESHOLD: {
+			WARN_PRINT("Space-specific contact reuse threshold is not supported when using Jolt Physics. Any such value will be ignored.");
+		} break;
+		case PhysicsServer3D::SPACE_PARAM_DETERMINISTIC: {
+			if (p_value == 0.0) {
+				WARN_PRINT("Non-deterministic spaces are not supported when using Jolt Physics. Any such value will be ignored.");
+			}
+		} break;
 		default: {
 			ERR_FAIL_MSG(vformat("Unhandled space parameter: '%d'. This should not happen. Please report this.", p_param));
 		} break;
@@ -388,6 +406,14 @@ void JoltSpace3D::set_default_area(JoltArea3D *p_area) {
 	}
 }
 
+uint64_t JoltSpace3D::get_temp_memory_capacity() const {
+	return temp_allocator->get_capacity();
+}
+
+uint64_t JoltSpace3D::get_temp_memory_peak() const {
+	return temp_allocator->get_last_peak();
+}
+
 JPH::BodyID JoltSpace3D::add_rigid_body(const JoltObject3D &p_object, const JPH::BodyCreationSettings &p_settings, bool p_sleeping) {
 	const JPH::BodyID body_id = get_body_iface().CreateAndAddBody(p_settings, p_sleeping ? JPH::EActivation::DontActivate : JPH::EActivation::Activate);
 
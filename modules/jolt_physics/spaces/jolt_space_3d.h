@@ -53,6 +53,7 @@ class JoltJoint3D;
 class JoltLayers;
 class JoltObject3D;
 class JoltPhysicsDirectSpaceState3D;
+class JoltTempAllocator;
 
 class JoltSpace3D {
 	JoltBodyWriter3D body_accessor;
@@ -60,7 +61,7 @@ class JoltSpace3D {
 	RID rid;
 
 	JPH::JobSystem *job_system = nullptr;
-	JPH::TempAllocator *temp_allocator = nullptr;
+	JoltTempAllocator *temp_allocator = nullptr;
 	JoltLayers *layers = nullptr;
 	JoltContactListener3D *contact_listener = nullptr;
 	JPH::PhysicsSystem *physics_system = nullptr;
@@ -125,6 +126,9 @@ public:
 
 	float get_last_step() const { return last_step; }
 
+	uint64_t get_temp_memory_capacity() const;
+	uint64_t get_temp_memory_peak() const;
+
 	JPH::BodyID add_rigid_body(const JoltObject3D &p_object, const JPH::BodyCreationSettings &p_settings, bool p_sleeping = false);
 	JPH::BodyID add_soft_body(const JoltObject3D &p_object, const JPH::SoftBodyCreationSettings &p_settings, bool p_sleeping = false);
 
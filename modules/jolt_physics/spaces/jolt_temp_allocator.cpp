@@ -50,6 +50,7 @@ ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WIT
 
 #include "../jolt_project_settings.h"
 
+#include "core/string/print_string.h"
 #include "core/variant/variant.h"
 
 #include "Jolt/Core/Memory.h"
@@ -87,14 +88,15 @@ void *JoltTempAllocator::Allocate(uint32_t p_size) {
 		ptr = base + top;
 	} else {
 		WARN_PRINT_ONCE(vformat("Jolt Physics temporary memory allocator exceeded capacity of %d MiB. "
-								"Falling back to slower general-purpose allocator. "
-								"Consider increasing maximum temporary memory in project settings.",
-				JoltProjectSettings::get_temp_memory_mib()));
+								"Falling back to slower general-purpose allocator until the end of the step, after which the buffer will grow. "
+								"Consider increasing temporary memory buffer size in project settings.",
+				int64_t(capacity / (1024 * 1024))));
 
 		ptr = JPH::Allocate(p_size);
 	}
 
 	top = new_top;
+	peak = MAX(peak, top);
 
 	return ptr;
 }
@@ -118,3 +120,23 @@ void JoltTempAllocator::Free(void *p_ptr, uint32_t p_size) {
 
 	top = new_top;
 }
+
+void JoltTempAllocator::end_step() {
+	ERR_FAIL_COND_MSG(top != 0, "Jolt Physics temporary memory was not freed by the end of the step.");
+
+	last_peak = peak;
+	peak = 0;
+
+	if (last_peak <= capacity) {
+		return;
+	}
+
+	// Leave some headroom, so that slowly growing scenes don't reallocate every few steps.
+	constexpr uint64_t granularity = 1024 * 1024;
+	capacity = align_up(last_peak + last_peak / 4, granularity);
+
+	JPH::Free(base);
+	base = static_cast<uint8_t *>(JPH::Allocate((size_t)capacity));
+
+	print_verbose(vformat("Jolt Physics temporary memory buffer grown to %d MiB.", int64_t(capacity / granularity)));
+}
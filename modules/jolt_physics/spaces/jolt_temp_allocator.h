@@ -40,6 +40,8 @@
 class JoltTempAllocator final : public JPH::TempAllocator {
 	uint64_t capacity = 0;
 	uint64_t top = 0;
+	uint64_t peak = 0;
+	uint64_t last_peak = 0;
 	uint8_t *base = nullptr;
 
 public:
@@ -48,6 +50,14 @@ public:
 
 	virtual void *Allocate(JPH::uint p_size) override;
 	virtual void Free(void *p_ptr, JPH::uint p_size) override;
+
+	// Must be called after each step, once everything has been freed. If the step needed more
+	// than the buffer holds, the buffer is grown to fit it, so only that one step falls back
+	// to the general-purpose allocator.
+	void end_step();
+
+	uint64_t get_capacity() const { return capacity; }
+	uint64_t get_last_peak() const { return last_peak; }
 };
 
 #endif // JOLT_TEMP_ALLOCATOR_H
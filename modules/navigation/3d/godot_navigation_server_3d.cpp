@@ -209,6 +209,34 @@ bool GodotNavigationServer3D::map_get_use_edge_connections(RID p_map) const {
 	return map->get_use_edge_connections();
 }
 
+COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled) {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_hierarchical_pathfinding(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_hierarchical_pathfinding(RID p_map) const {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_hierarchical_pathfinding();
+}
+
+COMMAND_2(map_set_hierarchy_cluster_size, RID, p_map, real_t, p_cluster_size) {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_hierarchy_cluster_size(p_cluster_size);
+}
+
+real_t GodotNavigationServer3D::map_get_hierarchy_cluster_size(RID p_map) const {
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_hierarchy_cluster_size();
+}
+
 COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin) {
 	NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
@@ -262,6 +290,74 @@ Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origi
 	return query_result->get_path();
 }
 
+void GodotNavigationServer3D::map_query_path_batch(RID p_map, const PackedVector3Array &p_start_target_positions, const PackedInt32Array &p_navigation_layers, const PackedInt32Array &p_path_postprocessing, PackedVector3Array &r_path_points, PackedInt32Array &r_path_point_counts) {
+	r_path_points.clear();
+	r_path_point_counts.clear();
+
+	NavMap *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	const int query_count = p_start_target_positions.size() / 2;
+	ERR_FAIL_COND_MSG(p_start_target_positions.size() != query_count * 2, "Path query batches need a start and a target position per query.");
+	ERR_FAIL_COND(p_navigation_layers.size() != query_count);
+	ERR_FAIL_COND(p_path_postprocessing.size() != query_count);
+
+	const Vector3 *start_target_positions = p_start_target_positions.ptr();
+	const int32_t *navigation_layers = p_navigation_layers.ptr();
+	const int32_t *path_postprocessing = p_path_postprocessing.ptr();
+
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> query_tasks;
+	query_tasks.resize(query_count);
+	for (int i = 0; i < query_count; i++) {
+		NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = query_tasks[i];
+		query_task.start_position = start_target_positions[i * 2];
+		query_task.target_position = start_target_positions[i * 2 + 1];
+		query_task.navigation_layers = navigation_layers[i];
+		query_task.metadata_flags = PathMetadataFlags::PATH_INCLUDE_NONE;
+
+		switch (path_postprocessing[i]) {
+			case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
+				query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			} break;
+			case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
+				query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			} break;
+			case NavigationPathQueryParameters3D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
+				query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			} break;
+			default: {
+				WARN_PRINT("No match for used PathPostProcessing - fallback to default");
+				query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			} break;
+		}
+	}
+
+	map->query_path_batch(query_tasks);
+
+	int path_point_count = 0;
+	int failed_count = 0;
+	r_path_point_counts.resize(query_count);
+	int32_t *path_point_counts = r_path_point_counts.ptrw();
+	for (int i = 0; i < query_count; i++) {
+		if (query_tasks[i].status == NavMeshQueries3D::NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
+			failed_count++;
+		}
+		path_point_counts[i] = query_tasks[i].path_points.size();
+		path_point_count += path_point_counts[i];
+	}
+	if (failed_count > 0) {
+		ERR_PRINT(vformat("%d of the %d path queries of the batch failed, their paths are empty.", failed_count, query_count));
+	}
+
+	r_path_points.resize(path_point_count);
+	Vector3 *path_points = r_path_points.ptrw();
+	for (const NavMeshQueries3D::NavMeshPathQueryTask3D &query_task : query_tasks) {
+		for (const Vector3 &path_point : query_task.path_points) {
+			*path_points++ = path_point;
+		}
+	}
+}
+
 Vector3 GodotNavigationServer3D::map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	const NavMap *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector3());
@@ -1192,6 +1288,26 @@ void GodotNavigationServer3D::bake_from_source_geometry_data_async(const Ref<Nav
 #endif // _3D_DISABLED
 }
 
+void GodotNavigationServer3D::rebake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+#ifndef _3D_DISABLED
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->rebake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+#endif // _3D_DISABLED
+}
+
+void GodotNavigationServer3D::rebake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+#ifndef _3D_DISABLED
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->rebake_tiles_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+#endif // _3D_DISABLED
+}
+
 bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const {
 #ifdef _3D_DISABLED
 	return false;
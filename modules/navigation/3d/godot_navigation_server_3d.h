@@ -126,6 +126,12 @@ public:
 	COMMAND_2(map_set_use_edge_connections, RID, p_map, bool, p_enabled);
 	virtual bool map_get_use_edge_connections(RID p_map) const override;
 
+	COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled);
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const override;
+
+	COMMAND_2(map_set_hierarchy_cluster_size, RID, p_map, real_t, p_cluster_size);
+	virtual real_t map_get_hierarchy_cluster_size(RID p_map) const override;
+
 	COMMAND_2(map_set_edge_connection_margin, RID, p_map, real_t, p_connection_margin);
 	virtual real_t map_get_edge_connection_margin(RID p_map) const override;
 
@@ -133,6 +139,7 @@ public:
 	virtual real_t map_get_link_connection_radius(RID p_map) const override;
 
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) override;
+	virtual void map_query_path_batch(RID p_map, const PackedVector3Array &p_start_target_positions, const PackedInt32Array &p_navigation_layers, const PackedInt32Array &p_path_postprocessing, PackedVector3Array &r_path_points, PackedInt32Array &r_path_point_counts) override;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const override;
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const override;
@@ -271,6 +278,8 @@ public:
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
+	virtual void rebake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) override;
+	virtual void rebake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) override;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const override;
 
 	virtual RID source_geometry_parser_create() override;
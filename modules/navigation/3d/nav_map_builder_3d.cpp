@@ -70,6 +70,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_hierarchy(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -382,6 +384,287 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild &r_bu
 			}
 		}
 	}
+
+	r_build.link_polygon_count = link_poly_idx;
+}
+
+void NavMapBuilder3D::_build_step_hierarchy(NavMapIterationBuild &r_build) {
+	NavMapIteration *map_iteration = r_build.map_iteration;
+
+	NavMapHierarchy3D &hierarchy = map_iteration->hierarchy;
+	HashMap<RID, NavMapIterationBuild::HierarchyRegionCache> &region_caches = r_build.hierarchy_region_cache;
+
+	hierarchy.clear();
+
+	if (!r_build.use_hierarchical_pathfinding) {
+		region_caches.clear();
+		return;
+	}
+
+	// The cached clusters depend on the cluster size and on how the region polygons got merged.
+	if (r_build.hierarchy_cache_cluster_size != r_build.hierarchy_cluster_size || r_build.hierarchy_cache_cell_size != r_build.merge_rasterizer_cell_size) {
+		region_caches.clear();
+		r_build.hierarchy_cache_cluster_size = r_build.hierarchy_cluster_size;
+		r_build.hierarchy_cache_cell_size = r_build.merge_rasterizer_cell_size;
+	}
+	for (KeyValue<RID, NavMapIterationBuild::HierarchyRegionCache> &E : region_caches) {
+		E.value.used = false;
+	}
+
+	const LocalVector<gd::Polygon> &polygons = map_iteration->navmesh_polygons;
+	const LocalVector<gd::Polygon> &link_polygons = map_iteration->link_polygons;
+	const uint32_t navmesh_polygon_count = polygons.size();
+	const uint32_t polygon_count = navmesh_polygon_count + link_polygons.size();
+	const real_t cluster_size = MAX(r_build.hierarchy_cluster_size, (real_t)CMP_EPSILON);
+
+	hierarchy.polygon_clusters.resize(polygon_count);
+	hierarchy.polygon_cluster_indices.resize(polygon_count);
+	hierarchy.polygon_portals.resize(polygon_count);
+	hierarchy.polygon_centers.resize(polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		const gd::Polygon &polygon = i < navmesh_polygon_count ? polygons[i] : link_polygons[i - navmesh_polygon_count];
+		Vector3 center;
+		for (const gd::Point &point : polygon.points) {
+			center += point.pos;
+		}
+		if (!polygon.points.is_empty()) {
+			center /= polygon.points.size();
+		}
+		hierarchy.polygon_centers[i] = center;
+		hierarchy.polygon_clusters[i] = UINT32_MAX;
+		hierarchy.polygon_cluster_indices[i] = UINT32_MAX;
+		hierarchy.polygon_portals[i] = UINT32_MAX;
+	}
+
+	// Where the portal costs of each cluster are cached, nullptr for link clusters.
+	LocalVector<NavMapIterationBuild::HierarchyRegionCache *> cluster_caches;
+	LocalVector<uint32_t> cluster_cache_indices;
+	LocalVector<uint32_t> cluster_polygon_offsets;
+	LocalVector<bool> cluster_region_changed;
+
+	real_t min_travel_cost = FLT_MAX;
+
+	// Group the polygons of each region by grid cell, only for regions that changed.
+	uint32_t polygon_offset = 0;
+	for (const NavRegionIteration &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		const uint32_t region_polygon_count = region.get_navmesh_polygons().size();
+
+		NavMapIterationBuild::HierarchyRegionCache *region_cache = region_caches.getptr(region.get_self());
+		const bool region_changed = region_cache == nullptr || region_cache->region_iteration_id != region.region_iteration_id || region_cache->travel_cost != region.get_travel_cost();
+		if (region_cache == nullptr) {
+			region_cache = &region_caches.insert(region.get_self(), NavMapIterationBuild::HierarchyRegionCache())->value;
+		}
+		region_cache->used = true;
+
+		if (region_changed) {
+			region_cache->region_iteration_id = region.region_iteration_id;
+			region_cache->travel_cost = region.get_travel_cost();
+			region_cache->cluster_polygons.clear();
+
+			HashMap<Vector3i, uint32_t> cell_clusters;
+			for (uint32_t i = 0; i < region_polygon_count; i++) {
+				const Vector3 cell_position = hierarchy.polygon_centers[polygon_offset + i] / cluster_size;
+				const Vector3i cell(static_cast<int32_t>(Math::floor(cell_position.x)), static_cast<int32_t>(Math::floor(cell_position.y)), static_cast<int32_t>(Math::floor(cell_position.z)));
+
+				HashMap<Vector3i, uint32_t>::Iterator cell_it = cell_clusters.find(cell);
+				if (!cell_it) {
+					cell_it = cell_clusters.insert(cell, region_cache->cluster_polygons.size());
+					region_cache->cluster_polygons.push_back(LocalVector<uint32_t>());
+				}
+				region_cache->cluster_polygons[cell_it->value].push_back(i);
+			}
+
+			region_cache->cluster_portals.clear();
+			region_cache->cluster_portals.resize(region_cache->cluster_polygons.size());
+			region_cache->cluster_portal_costs.clear();
+			region_cache->cluster_portal_costs.resize(region_cache->cluster_polygons.size());
+		}
+
+		for (uint32_t cache_index = 0; cache_index < region_cache->cluster_polygons.size(); cache_index++) {
+			const uint32_t cluster_id = hierarchy.clusters.size();
+			hierarchy.clusters.push_back(NavMapHierarchy3D::Cluster());
+			NavMapHierarchy3D::Cluster &cluster = hierarchy.clusters[cluster_id];
+			cluster.region_id = region.id;
+			cluster.navigation_layers = region.get_navigation_layers();
+			cluster.travel_cost = region.get_travel_cost();
+
+			const LocalVector<uint32_t> &cluster_polygons = region_cache->cluster_polygons[cache_index];
+			cluster.polygons.resize(cluster_polygons.size());
+			for (uint32_t i = 0; i < cluster_polygons.size(); i++) {
+				const uint32_t polygon_id = polygon_offset + cluster_polygons[i];
+				cluster.polygons[i] = polygon_id;
+				hierarchy.polygon_clusters[polygon_id] = cluster_id;
+				hierarchy.polygon_cluster_indices[polygon_id] = i;
+			}
+			hierarchy.max_cluster_polygon_count = MAX(hierarchy.max_cluster_polygon_count, cluster.polygons.size());
+
+			cluster_caches.push_back(region_cache);
+			cluster_cache_indices.push_back(cache_index);
+			cluster_polygon_offsets.push_back(polygon_offset);
+			cluster_region_changed.push_back(region_changed);
+		}
+
+		min_travel_cost = MIN(min_travel_cost, region.get_travel_cost());
+		polygon_offset += region_polygon_count;
+	}
+
+	// Every link gets a cluster of its own.
+	for (int i = 0; i < r_build.link_polygon_count; i++) {
+		const gd::Polygon &link_polygon = link_polygons[i];
+		const uint32_t cluster_id = hierarchy.clusters.size();
+		hierarchy.clusters.push_back(NavMapHierarchy3D::Cluster());
+		NavMapHierarchy3D::Cluster &cluster = hierarchy.clusters[cluster_id];
+		cluster.navigation_layers = link_polygon.owner->get_navigation_layers();
+		cluster.travel_cost = link_polygon.owner->get_travel_cost();
+		cluster.polygons.push_back(link_polygon.id);
+		hierarchy.polygon_clusters[link_polygon.id] = cluster_id;
+		hierarchy.polygon_cluster_indices[link_polygon.id] = 0;
+		hierarchy.max_cluster_polygon_count = MAX(hierarchy.max_cluster_polygon_count, 1u);
+
+		cluster_caches.push_back(nullptr);
+		cluster_cache_indices.push_back(0);
+		cluster_polygon_offsets.push_back(0);
+		cluster_region_changed.push_back(true);
+
+		min_travel_cost = MIN(min_travel_cost, cluster.travel_cost);
+	}
+
+	hierarchy.min_travel_cost = min_travel_cost == FLT_MAX ? 1.0 : MAX(min_travel_cost, (real_t)0.0);
+
+	// Portals are the polygons with a connection crossing a cluster border, in either direction.
+	LocalVector<uint8_t> polygon_is_portal;
+	polygon_is_portal.resize(polygon_count);
+	memset(polygon_is_portal.ptr(), 0, polygon_count);
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		if (hierarchy.polygon_clusters[i] == UINT32_MAX) {
+			continue;
+		}
+		const gd::Polygon &polygon = i < navmesh_polygon_count ? polygons[i] : link_polygons[i - navmesh_polygon_count];
+		for (const gd::Edge &edge : polygon.edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				if (hierarchy.polygon_clusters[connection.polygon->id] != hierarchy.polygon_clusters[i]) {
+					polygon_is_portal[i] = 1;
+					polygon_is_portal[connection.polygon->id] = 1;
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		if (!polygon_is_portal[i]) {
+			continue;
+		}
+		const uint32_t portal_id = hierarchy.portal_polygons.size();
+		NavMapHierarchy3D::Cluster &cluster = hierarchy.clusters[hierarchy.polygon_clusters[i]];
+		hierarchy.polygon_portals[i] = portal_id;
+		hierarchy.portal_polygons.push_back(i);
+		hierarchy.portal_cluster_indices.push_back(cluster.portals.size());
+		cluster.portals.push_back(portal_id);
+	}
+
+	// Edges between portals of different clusters.
+	hierarchy.portal_edges.resize(hierarchy.portal_polygons.size());
+	for (uint32_t portal_id = 0; portal_id < hierarchy.portal_polygons.size(); portal_id++) {
+		const uint32_t polygon_id = hierarchy.portal_polygons[portal_id];
+		const gd::Polygon &polygon = polygon_id < navmesh_polygon_count ? polygons[polygon_id] : link_polygons[polygon_id - navmesh_polygon_count];
+		NavMapHierarchy3D::Cluster &cluster = hierarchy.clusters[hierarchy.polygon_clusters[polygon_id]];
+
+		for (const gd::Edge &edge : polygon.edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				const uint32_t target_polygon_id = connection.polygon->id;
+				const uint32_t target_cluster_id = hierarchy.polygon_clusters[target_polygon_id];
+				if (target_cluster_id == hierarchy.polygon_clusters[polygon_id]) {
+					continue;
+				}
+				const NavMapHierarchy3D::Cluster &target_cluster = hierarchy.clusters[target_cluster_id];
+
+				// Same costs as the polygon search: half the way in each polygon, plus entering another owner.
+				NavMapHierarchy3D::PortalEdge portal_edge;
+				portal_edge.portal = hierarchy.polygon_portals[target_polygon_id];
+				portal_edge.cost = hierarchy.polygon_centers[polygon_id].distance_to(hierarchy.polygon_centers[target_polygon_id]) * (cluster.travel_cost + target_cluster.travel_cost) * 0.5;
+				if (polygon.owner != connection.polygon->owner) {
+					portal_edge.cost += connection.polygon->owner->get_enter_cost();
+				}
+				hierarchy.portal_edges[portal_id].push_back(portal_edge);
+
+				if (!cluster.neighbors.has(target_cluster_id)) {
+					cluster.neighbors.push_back(target_cluster_id);
+				}
+			}
+		}
+	}
+
+	// Costs between the portals of a cluster, reused when neither the region nor the portals changed.
+	for (uint32_t cluster_id = 0; cluster_id < hierarchy.clusters.size(); cluster_id++) {
+		NavMapHierarchy3D::Cluster &cluster = hierarchy.clusters[cluster_id];
+		NavMapIterationBuild::HierarchyRegionCache *region_cache = cluster_caches[cluster_id];
+
+		if (region_cache == nullptr) {
+			// Link clusters only hold a single polygon.
+			cluster.portal_costs.resize(cluster.portals.size() * cluster.portals.size());
+			for (real_t &portal_cost : cluster.portal_costs) {
+				portal_cost = 0.0;
+			}
+			continue;
+		}
+
+		LocalVector<uint32_t> &cached_portals = region_cache->cluster_portals[cluster_cache_indices[cluster_id]];
+		LocalVector<real_t> &cached_portal_costs = region_cache->cluster_portal_costs[cluster_cache_indices[cluster_id]];
+
+		bool portals_changed = cluster_region_changed[cluster_id] || cached_portals.size() != cluster.portals.size();
+		for (uint32_t i = 0; !portals_changed && i < cluster.portals.size(); i++) {
+			portals_changed = cached_portals[i] != hierarchy.portal_polygons[cluster.portals[i]] - cluster_polygon_offsets[cluster_id];
+		}
+
+		if (!portals_changed) {
+			cluster.portal_costs = cached_portal_costs;
+			continue;
+		}
+
+		_build_hierarchy_cluster_portal_costs(map_iteration, cluster_id);
+		r_build.hierarchy_rebuilt_cluster_count += 1;
+
+		cached_portals.resize(cluster.portals.size());
+		for (uint32_t i = 0; i < cluster.portals.size(); i++) {
+			cached_portals[i] = hierarchy.portal_polygons[cluster.portals[i]] - cluster_polygon_offsets[cluster_id];
+		}
+		cached_portal_costs = cluster.portal_costs;
+	}
+
+	// Forget the regions that left the map.
+	LocalVector<RID> unused_regions;
+	for (const KeyValue<RID, NavMapIterationBuild::HierarchyRegionCache> &E : region_caches) {
+		if (!E.value.used) {
+			unused_regions.push_back(E.key);
+		}
+	}
+	for (const RID &region_rid : unused_regions) {
+		region_caches.erase(region_rid);
+	}
+
+	hierarchy.enabled = true;
+}
+
+void NavMapBuilder3D::_build_hierarchy_cluster_portal_costs(NavMapIteration *p_map_iteration, uint32_t p_cluster_id) {
+	NavMapHierarchy3D &hierarchy = p_map_iteration->hierarchy;
+	NavMapHierarchy3D::Cluster &cluster = hierarchy.clusters[p_cluster_id];
+	const uint32_t portal_count = cluster.portals.size();
+
+	cluster.portal_costs.resize(portal_count * portal_count);
+
+	LocalVector<real_t> distances;
+	for (uint32_t i = 0; i < portal_count; i++) {
+		const uint32_t polygon_id = hierarchy.portal_polygons[cluster.portals[i]];
+		NavMeshQueries3D::hierarchy_cluster_get_distances(hierarchy, p_map_iteration->navmesh_polygons, p_cluster_id, polygon_id, hierarchy.polygon_centers[polygon_id], distances);
+
+		for (uint32_t j = 0; j < portal_count; j++) {
+			const uint32_t other_polygon_id = hierarchy.portal_polygons[cluster.portals[j]];
+			cluster.portal_costs[i * portal_count + j] = distances[hierarchy.polygon_cluster_indices[other_polygon_id]];
+		}
+	}
 }
 
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild &r_build) {
@@ -399,6 +682,15 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild &r_build)
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count + map_iteration->link_polygon_count);
+
+		p_path_query_slot.hierarchy_portal_costs.clear();
+		p_path_query_slot.hierarchy_portal_costs.resize(map_iteration->hierarchy.portal_polygons.size());
+		p_path_query_slot.hierarchy_portal_parents.clear();
+		p_path_query_slot.hierarchy_portal_parents.resize(map_iteration->hierarchy.portal_polygons.size());
+		p_path_query_slot.hierarchy_corridor_clusters.clear();
+		p_path_query_slot.hierarchy_corridor_clusters.resize(map_iteration->hierarchy.clusters.size());
+		p_path_query_slot.hierarchy_begin_distances.reserve(map_iteration->hierarchy.max_cluster_polygon_count);
+		p_path_query_slot.hierarchy_end_distances.reserve(map_iteration->hierarchy.max_cluster_polygon_count);
 	}
 	map_iteration->path_query_slots_mutex.unlock();
 }
@@ -33,6 +33,7 @@
 
 #include "../nav_utils.h"
 
+struct NavMapIteration;
 struct NavMapIterationBuild;
 
 class NavMapBuilder3D {
@@ -41,6 +42,8 @@ class NavMapBuilder3D {
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild &r_build);
+	static void _build_step_hierarchy(NavMapIterationBuild &r_build);
+	static void _build_hierarchy_cluster_portal_costs(NavMapIteration *p_map_iteration, uint32_t p_cluster_id);
 	static void _build_update_map_iteration(NavMapIterationBuild &r_build);
 
 public:
@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  nav_map_hierarchy_3d.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef NAV_MAP_HIERARCHY_3D_H
+#define NAV_MAP_HIERARCHY_3D_H
+
+#include "core/math/vector3.h"
+#include "core/templates/local_vector.h"
+
+// Coarse graph on top of the map polygons used by hierarchical pathfinding.
+// Polygons are grouped into clusters (one grid cell of one region, or one link)
+// and only the polygons at cluster borders, the portals, are part of the graph.
+struct NavMapHierarchy3D {
+	struct PortalEdge {
+		/// Portal this edge leads to.
+		uint32_t portal = UINT32_MAX;
+		real_t cost = 0.0;
+	};
+
+	struct Cluster {
+		/// Owning region iteration id, or UINT32_MAX for a link cluster.
+		uint32_t region_id = UINT32_MAX;
+		uint32_t navigation_layers = 0;
+		real_t travel_cost = 1.0;
+
+		/// Map polygon ids of the cluster.
+		LocalVector<uint32_t> polygons;
+		/// Portal ids of the cluster, in the order used by `portal_costs`.
+		LocalVector<uint32_t> portals;
+		/// Cost of traveling between two portals inside the cluster, row-major.
+		LocalVector<real_t> portal_costs;
+		/// Clusters reachable through one of the portals.
+		LocalVector<uint32_t> neighbors;
+	};
+
+	bool enabled = false;
+
+	/// Per map polygon id (navmesh polygons first, then link polygons).
+	LocalVector<uint32_t> polygon_clusters;
+	LocalVector<uint32_t> polygon_cluster_indices;
+	LocalVector<uint32_t> polygon_portals;
+	LocalVector<Vector3> polygon_centers;
+
+	LocalVector<Cluster> clusters;
+
+	/// Per portal id.
+	LocalVector<uint32_t> portal_polygons;
+	LocalVector<uint32_t> portal_cluster_indices;
+	LocalVector<LocalVector<PortalEdge>> portal_edges;
+
+	/// Lowest travel cost of the map, keeps the coarse search heuristic admissible.
+	real_t min_travel_cost = 1.0;
+	uint32_t max_cluster_polygon_count = 0;
+
+	void clear() {
+		enabled = false;
+		polygon_clusters.clear();
+		polygon_cluster_indices.clear();
+		polygon_portals.clear();
+		polygon_centers.clear();
+		clusters.clear();
+		portal_polygons.clear();
+		portal_cluster_indices.clear();
+		portal_edges.clear();
+		min_travel_cost = 1.0;
+		max_cluster_polygon_count = 0;
+	}
+};
+
+#endif // NAV_MAP_HIERARCHY_3D_H
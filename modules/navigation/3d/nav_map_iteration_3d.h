@@ -33,6 +33,7 @@
 
 #include "../nav_rid.h"
 #include "../nav_utils.h"
+#include "nav_map_hierarchy_3d.h"
 #include "nav_mesh_queries_3d.h"
 
 #include "core/math/math_defs.h"
@@ -44,6 +45,20 @@ struct NavRegionIteration;
 struct NavMapIteration;
 
 struct NavMapIterationBuild {
+	// Cluster layout and portal costs of a region, kept between builds so that
+	// only the clusters of changed regions need their costs computed again.
+	struct HierarchyRegionCache {
+		uint32_t region_iteration_id = 0;
+		real_t travel_cost = 1.0;
+		bool used = false;
+
+		/// Local polygon indices of each cluster.
+		LocalVector<LocalVector<uint32_t>> cluster_polygons;
+		/// Local polygon indices of the portals of each cluster, with their costs.
+		LocalVector<LocalVector<uint32_t>> cluster_portals;
+		LocalVector<LocalVector<real_t>> cluster_portal_costs;
+	};
+
 	Vector3 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
@@ -52,6 +67,13 @@ struct NavMapIterationBuild {
 	int polygon_count = 0;
 	int free_edge_count = 0;
 
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchy_cluster_size = 16.0;
+	HashMap<RID, HierarchyRegionCache> hierarchy_region_cache;
+	real_t hierarchy_cache_cluster_size = 0.0;
+	Vector3 hierarchy_cache_cell_size;
+	int hierarchy_rebuilt_cluster_count = 0;
+
 	HashMap<gd::EdgeKey, gd::EdgeConnectionPair, gd::EdgeKey> iter_connection_pairs_map;
 	LocalVector<gd::Edge::Connection> iter_free_edges;
 
@@ -67,6 +89,7 @@ struct NavMapIterationBuild {
 		iter_free_edges.clear();
 		polygon_count = 0;
 		free_edge_count = 0;
+		hierarchy_rebuilt_cluster_count = 0;
 
 		navmesh_polygon_count = 0;
 		link_polygon_count = 0;
@@ -77,6 +100,8 @@ struct NavMapIteration {
 	mutable SafeNumeric<uint32_t> users;
 	RWLock rwlock;
 
+	uint32_t iteration_id = 0;
+
 	Vector3 map_up;
 	LocalVector<gd::Polygon> navmesh_polygons;
 	LocalVector<gd::Polygon> link_polygons;
@@ -92,6 +117,8 @@ struct NavMapIteration {
 
 	HashMap<NavRegion *, uint32_t> region_ptr_to_region_id;
 
+	NavMapHierarchy3D hierarchy;
+
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
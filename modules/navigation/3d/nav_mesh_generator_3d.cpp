@@ -34,6 +34,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/convex_hull.h"
+#include "core/os/os.h"
 #include "core/os/thread.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/multimesh_instance_3d.h"
@@ -71,6 +72,26 @@ bool NavMeshGenerator3D::baking_use_multiple_threads = true;
 bool NavMeshGenerator3D::baking_use_high_priority_threads = true;
 HashSet<Ref<NavigationMesh>> NavMeshGenerator3D::baking_navmeshes;
 HashMap<WorkerThreadPool::TaskID, NavMeshGenerator3D::NavMeshGeneratorTask3D *> NavMeshGenerator3D::generator_tasks;
+Mutex NavMeshGenerator3D::tile_cache_mutex;
+HashMap<ObjectID, NavMeshGenerator3D::NavMeshTileCache3D> NavMeshGenerator3D::tile_caches;
+
+struct NavMeshGenerator3D::NavMeshGeometryParseItem3D {
+	Transform3D xform;
+	// Mesh surfaces are read on the main thread, workers only transform their triangles.
+	LocalVector<Array> mesh_surface_arrays;
+	// Collision shapes are turned into triangles on workers.
+	Ref<Shape3D> shape;
+	PhysicsServer3D::ShapeType physics_shape_type = PhysicsServer3D::SHAPE_CUSTOM;
+	Variant physics_shape_data;
+
+	Ref<NavigationMeshSourceGeometryData3D> geometry;
+};
+
+struct NavMeshGenerator3D::NavMeshGeometryParseJob3D {
+	Transform3D root_node_transform;
+	LocalVector<NavMeshGeometryParseItem3D> items;
+};
+
 RID_Owner<NavMeshGenerator3D::NavMeshGeometryParser3D> NavMeshGenerator3D::generator_parser_owner;
 LocalVector<NavMeshGenerator3D::NavMeshGeometryParser3D *> NavMeshGenerator3D::generator_parsers;
 
@@ -141,6 +162,10 @@ void NavMeshGenerator3D::cleanup() {
 		}
 		generator_tasks.clear();
 
+		tile_cache_mutex.lock();
+		tile_caches.clear();
+		tile_cache_mutex.unlock();
+
 		generator_rid_rwlock.write_lock();
 		for (NavMeshGeometryParser3D *parser : generator_parsers) {
 			generator_parser_owner.free(parser->self);
@@ -169,6 +194,24 @@ void NavMeshGenerator3D::parse_source_geometry_data(Ref<NavigationMesh> p_naviga
 }
 
 void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+	generator_bake(p_navigation_mesh, p_source_geometry_data, AABB(), p_callback);
+}
+
+void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+	generator_bake_async(p_navigation_mesh, p_source_geometry_data, AABB(), p_callback);
+}
+
+void NavMeshGenerator3D::rebake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(!p_dirty_aabb.has_surface(), "The dirty AABB is empty, no tile would be baked again.");
+	generator_bake(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+}
+
+void NavMeshGenerator3D::rebake_tiles_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(!p_dirty_aabb.has_surface(), "The dirty AABB is empty, no tile would be baked again.");
+	generator_bake_async(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+}
+
+void NavMeshGenerator3D::generator_bake(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
 
@@ -187,7 +230,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	baking_navmeshes.insert(p_navigation_mesh);
 	baking_navmesh_mutex.unlock();
 
-	generator_bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data);
+	generator_bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb);
 
 	baking_navmesh_mutex.lock();
 	baking_navmeshes.erase(p_navigation_mesh);
@@ -198,7 +241,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	}
 }
 
-void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+void NavMeshGenerator3D::generator_bake_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
 
@@ -211,7 +254,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	}
 
 	if (!use_threads) {
-		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
+		generator_bake(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
 		return;
 	}
 
@@ -227,6 +270,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	NavMeshGeneratorTask3D *generator_task = memnew(NavMeshGeneratorTask3D);
 	generator_task->navigation_mesh = p_navigation_mesh;
 	generator_task->source_geometry_data = p_source_geometry_data;
+	generator_task->dirty_aabb = p_dirty_aabb;
 	generator_task->callback = p_callback;
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake, generator_task, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBake3D"));
@@ -241,20 +285,20 @@ bool NavMeshGenerator3D::is_baking(Ref<NavigationMesh> p_navigation_mesh) {
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
-	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data);
+	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data, generator_task->dirty_aabb);
 
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED;
 }
 
-void NavMeshGenerator3D::generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children) {
-	generator_parse_meshinstance3d_node(p_navigation_mesh, p_source_geometry_data, p_node);
-	generator_parse_multimeshinstance3d_node(p_navigation_mesh, p_source_geometry_data, p_node);
-	generator_parse_staticbody3d_node(p_navigation_mesh, p_source_geometry_data, p_node);
+void NavMeshGenerator3D::generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children, NavMeshGeometryParseJob3D &r_parse_job) {
+	generator_parse_meshinstance3d_node(p_navigation_mesh, r_parse_job, p_node);
+	generator_parse_multimeshinstance3d_node(p_navigation_mesh, r_parse_job, p_node);
+	generator_parse_staticbody3d_node(p_navigation_mesh, r_parse_job, p_node);
 #ifdef MODULE_CSG_ENABLED
-	generator_parse_csgshape3d_node(p_navigation_mesh, p_source_geometry_data, p_node);
+	generator_parse_csgshape3d_node(p_navigation_mesh, r_parse_job, p_node);
 #endif
 #ifdef MODULE_GRIDMAP_ENABLED
-	generator_parse_gridmap_node(p_navigation_mesh, p_source_geometry_data, p_node);
+	generator_parse_gridmap_node(p_navigation_mesh, r_parse_job, p_node);
 #endif
 	generator_parse_navigationobstacle_node(p_navigation_mesh, p_source_geometry_data, p_node);
 
@@ -269,12 +313,26 @@ void NavMeshGenerator3D::generator_parse_geometry_node(const Ref<NavigationMesh>
 
 	if (p_recurse_children) {
 		for (int i = 0; i < p_node->get_child_count(); i++) {
-			generator_parse_geometry_node(p_navigation_mesh, p_source_geometry_data, p_node->get_child(i), p_recurse_children);
+			generator_parse_geometry_node(p_navigation_mesh, p_source_geometry_data, p_node->get_child(i), p_recurse_children, r_parse_job);
+		}
+	}
+}
+
+void NavMeshGenerator3D::generator_get_mesh_surface_arrays(const Ref<Mesh> &p_mesh, LocalVector<Array> &r_surface_arrays) {
+	NavigationMeshSourceGeometryData3D::_warn_runtime_mesh_parsing();
+
+	for (int i = 0; i < p_mesh->get_surface_count(); i++) {
+		if (p_mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES) {
+			continue;
 		}
+
+		Array a = p_mesh->surface_get_arrays(i);
+		ERR_CONTINUE(a.is_empty() || (a.size() != Mesh::ARRAY_MAX));
+		r_surface_arrays.push_back(a);
 	}
 }
 
-void NavMeshGenerator3D::generator_parse_meshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node) {
+void NavMeshGenerator3D::generator_parse_meshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node) {
 	MeshInstance3D *mesh_instance = Object::cast_to<MeshInstance3D>(p_node);
 
 	if (mesh_instance) {
@@ -283,13 +341,16 @@ void NavMeshGenerator3D::generator_parse_meshinstance3d_node(const Ref<Navigatio
 		if (parsed_geometry_type == NavigationMesh::PARSED_GEOMETRY_MESH_INSTANCES || parsed_geometry_type == NavigationMesh::PARSED_GEOMETRY_BOTH) {
 			Ref<Mesh> mesh = mesh_instance->get_mesh();
 			if (mesh.is_valid()) {
-				p_source_geometry_data->add_mesh(mesh, mesh_instance->get_global_transform());
+				NavMeshGeometryParseItem3D parse_item;
+				parse_item.xform = mesh_instance->get_global_transform();
+				generator_get_mesh_surface_arrays(mesh, parse_item.mesh_surface_arrays);
+				r_parse_job.items.push_back(parse_item);
 			}
 		}
 	}
 }
 
-void NavMeshGenerator3D::generator_parse_multimeshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node) {
+void NavMeshGenerator3D::generator_parse_multimeshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node) {
 	MultiMeshInstance3D *multimesh_instance = Object::cast_to<MultiMeshInstance3D>(p_node);
 
 	if (multimesh_instance) {
@@ -304,8 +365,12 @@ void NavMeshGenerator3D::generator_parse_multimeshinstance3d_node(const Ref<Navi
 					if (n == -1) {
 						n = multimesh->get_instance_count();
 					}
+					// All instances share the surfaces read once from the mesh.
+					NavMeshGeometryParseItem3D parse_item;
+					generator_get_mesh_surface_arrays(mesh, parse_item.mesh_surface_arrays);
 					for (int i = 0; i < n; i++) {
-						p_source_geometry_data->add_mesh(mesh, multimesh_instance->get_global_transform() * multimesh->get_instance_transform(i));
+						parse_item.xform = multimesh_instance->get_global_transform() * multimesh->get_instance_transform(i);
+						r_parse_job.items.push_back(parse_item);
 					}
 				}
 			}
@@ -313,7 +378,7 @@ void NavMeshGenerator3D::generator_parse_multimeshinstance3d_node(const Ref<Navi
 	}
 }
 
-void NavMeshGenerator3D::generator_parse_staticbody3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node) {
+void NavMeshGenerator3D::generator_parse_staticbody3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node) {
 	StaticBody3D *static_body = Object::cast_to<StaticBody3D>(p_node);
 
 	if (static_body) {
@@ -334,100 +399,10 @@ void NavMeshGenerator3D::generator_parse_staticbody3d_node(const Ref<NavigationM
 						continue;
 					}
 
-					const Transform3D transform = static_body->get_global_transform() * static_body->shape_owner_get_transform(shape_owner);
-
-					BoxShape3D *box = Object::cast_to<BoxShape3D>(*s);
-					if (box) {
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						BoxMesh::create_mesh_array(arr, box->get_size());
-						p_source_geometry_data->add_mesh_array(arr, transform);
-					}
-
-					CapsuleShape3D *capsule = Object::cast_to<CapsuleShape3D>(*s);
-					if (capsule) {
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						CapsuleMesh::create_mesh_array(arr, capsule->get_radius(), capsule->get_height());
-						p_source_geometry_data->add_mesh_array(arr, transform);
-					}
-
-					CylinderShape3D *cylinder = Object::cast_to<CylinderShape3D>(*s);
-					if (cylinder) {
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						CylinderMesh::create_mesh_array(arr, cylinder->get_radius(), cylinder->get_radius(), cylinder->get_height());
-						p_source_geometry_data->add_mesh_array(arr, transform);
-					}
-
-					SphereShape3D *sphere = Object::cast_to<SphereShape3D>(*s);
-					if (sphere) {
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						SphereMesh::create_mesh_array(arr, sphere->get_radius(), sphere->get_radius() * 2.0);
-						p_source_geometry_data->add_mesh_array(arr, transform);
-					}
-
-					ConcavePolygonShape3D *concave_polygon = Object::cast_to<ConcavePolygonShape3D>(*s);
-					if (concave_polygon) {
-						p_source_geometry_data->add_faces(concave_polygon->get_faces(), transform);
-					}
-
-					ConvexPolygonShape3D *convex_polygon = Object::cast_to<ConvexPolygonShape3D>(*s);
-					if (convex_polygon) {
-						Vector<Vector3> varr = Variant(convex_polygon->get_points());
-						Geometry3D::MeshData md;
-
-						Error err = ConvexHullComputer::convex_hull(varr, md);
-
-						if (err == OK) {
-							PackedVector3Array faces;
-
-							for (const Geometry3D::MeshData::Face &face : md.faces) {
-								for (uint32_t k = 2; k < face.indices.size(); ++k) {
-									faces.push_back(md.vertices[face.indices[0]]);
-									faces.push_back(md.vertices[face.indices[k - 1]]);
-									faces.push_back(md.vertices[face.indices[k]]);
-								}
-							}
-
-							p_source_geometry_data->add_faces(faces, transform);
-						}
-					}
-
-					HeightMapShape3D *heightmap_shape = Object::cast_to<HeightMapShape3D>(*s);
-					if (heightmap_shape) {
-						int heightmap_depth = heightmap_shape->get_map_depth();
-						int heightmap_width = heightmap_shape->get_map_width();
-
-						if (heightmap_depth >= 2 && heightmap_width >= 2) {
-							const Vector<real_t> &map_data = heightmap_shape->get_map_data();
-
-							Vector2 heightmap_gridsize(heightmap_width - 1, heightmap_depth - 1);
-							Vector3 start = Vector3(heightmap_gridsize.x, 0, heightmap_gridsize.y) * -0.5;
-
-							Vector<Vector3> vertex_array;
-							vertex_array.resize((heightmap_depth - 1) * (heightmap_width - 1) * 6);
-							Vector3 *vertex_array_ptrw = vertex_array.ptrw();
-							const real_t *map_data_ptr = map_data.ptr();
-							int vertex_index = 0;
-
-							for (int d = 0; d < heightmap_depth - 1; d++) {
-								for (int w = 0; w < heightmap_width - 1; w++) {
-									vertex_array_ptrw[vertex_index] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + w], d);
-									vertex_array_ptrw[vertex_index + 1] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
-									vertex_array_ptrw[vertex_index + 2] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
-									vertex_array_ptrw[vertex_index + 3] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
-									vertex_array_ptrw[vertex_index + 4] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + heightmap_width + w + 1], d + 1);
-									vertex_array_ptrw[vertex_index + 5] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
-									vertex_index += 6;
-								}
-							}
-							if (vertex_array.size() > 0) {
-								p_source_geometry_data->add_faces(vertex_array, transform);
-							}
-						}
-					}
+					NavMeshGeometryParseItem3D parse_item;
+					parse_item.xform = static_body->get_global_transform() * static_body->shape_owner_get_transform(shape_owner);
+					parse_item.shape = s;
+					r_parse_job.items.push_back(parse_item);
 				}
 			}
 		}
@@ -435,7 +410,7 @@ void NavMeshGenerator3D::generator_parse_staticbody3d_node(const Ref<NavigationM
 }
 
 #ifdef MODULE_CSG_ENABLED
-void NavMeshGenerator3D::generator_parse_csgshape3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node) {
+void NavMeshGenerator3D::generator_parse_csgshape3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node) {
 	CSGShape3D *csgshape3d = Object::cast_to<CSGShape3D>(p_node);
 
 	if (csgshape3d) {
@@ -448,7 +423,10 @@ void NavMeshGenerator3D::generator_parse_csgshape3d_node(const Ref<NavigationMes
 			if (!meshes.is_empty()) {
 				Ref<Mesh> mesh = meshes[1];
 				if (mesh.is_valid()) {
-					p_source_geometry_data->add_mesh(mesh, csg_shape->get_global_transform());
+					NavMeshGeometryParseItem3D parse_item;
+					parse_item.xform = csg_shape->get_global_transform();
+					generator_get_mesh_surface_arrays(mesh, parse_item.mesh_surface_arrays);
+					r_parse_job.items.push_back(parse_item);
 				}
 			}
 		}
@@ -457,7 +435,7 @@ void NavMeshGenerator3D::generator_parse_csgshape3d_node(const Ref<NavigationMes
 #endif // MODULE_CSG_ENABLED
 
 #ifdef MODULE_GRIDMAP_ENABLED
-void NavMeshGenerator3D::generator_parse_gridmap_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node) {
+void NavMeshGenerator3D::generator_parse_gridmap_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node) {
 	GridMap *gridmap = Object::cast_to<GridMap>(p_node);
 
 	if (gridmap) {
@@ -470,7 +448,10 @@ void NavMeshGenerator3D::generator_parse_gridmap_node(const Ref<NavigationMesh>
 			for (int i = 0; i < meshes.size(); i += 2) {
 				Ref<Mesh> mesh = meshes[i + 1];
 				if (mesh.is_valid()) {
-					p_source_geometry_data->add_mesh(mesh, xform * (Transform3D)meshes[i]);
+					NavMeshGeometryParseItem3D parse_item;
+					parse_item.xform = xform * (Transform3D)meshes[i];
+					generator_get_mesh_surface_arrays(mesh, parse_item.mesh_surface_arrays);
+					r_parse_job.items.push_back(parse_item);
 				}
 			}
 		}
@@ -479,105 +460,11 @@ void NavMeshGenerator3D::generator_parse_gridmap_node(const Ref<NavigationMesh>
 			Array shapes = gridmap->get_collision_shapes();
 			for (int i = 0; i < shapes.size(); i += 2) {
 				RID shape = shapes[i + 1];
-				PhysicsServer3D::ShapeType type = PhysicsServer3D::get_singleton()->shape_get_type(shape);
-				Variant data = PhysicsServer3D::get_singleton()->shape_get_data(shape);
-
-				switch (type) {
-					case PhysicsServer3D::SHAPE_SPHERE: {
-						real_t radius = data;
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						SphereMesh::create_mesh_array(arr, radius, radius * 2.0);
-						p_source_geometry_data->add_mesh_array(arr, shapes[i]);
-					} break;
-					case PhysicsServer3D::SHAPE_BOX: {
-						Vector3 extents = data;
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						BoxMesh::create_mesh_array(arr, extents * 2.0);
-						p_source_geometry_data->add_mesh_array(arr, shapes[i]);
-					} break;
-					case PhysicsServer3D::SHAPE_CAPSULE: {
-						Dictionary dict = data;
-						real_t radius = dict["radius"];
-						real_t height = dict["height"];
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						CapsuleMesh::create_mesh_array(arr, radius, height);
-						p_source_geometry_data->add_mesh_array(arr, shapes[i]);
-					} break;
-					case PhysicsServer3D::SHAPE_CYLINDER: {
-						Dictionary dict = data;
-						real_t radius = dict["radius"];
-						real_t height = dict["height"];
-						Array arr;
-						arr.resize(RS::ARRAY_MAX);
-						CylinderMesh::create_mesh_array(arr, radius, radius, height);
-						p_source_geometry_data->add_mesh_array(arr, shapes[i]);
-					} break;
-					case PhysicsServer3D::SHAPE_CONVEX_POLYGON: {
-						PackedVector3Array vertices = data;
-						Geometry3D::MeshData md;
-
-						Error err = ConvexHullComputer::convex_hull(vertices, md);
-
-						if (err == OK) {
-							PackedVector3Array faces;
-
-							for (const Geometry3D::MeshData::Face &face : md.faces) {
-								for (uint32_t k = 2; k < face.indices.size(); ++k) {
-									faces.push_back(md.vertices[face.indices[0]]);
-									faces.push_back(md.vertices[face.indices[k - 1]]);
-									faces.push_back(md.vertices[face.indices[k]]);
-								}
-							}
-
-							p_source_geometry_data->add_faces(faces, shapes[i]);
-						}
-					} break;
-					case PhysicsServer3D::SHAPE_CONCAVE_POLYGON: {
-						Dictionary dict = data;
-						PackedVector3Array faces = Variant(dict["faces"]);
-						p_source_geometry_data->add_faces(faces, shapes[i]);
-					} break;
-					case PhysicsServer3D::SHAPE_HEIGHTMAP: {
-						Dictionary dict = data;
-						///< dict( int:"width", int:"depth",float:"cell_size", float_array:"heights"
-						int heightmap_depth = dict["depth"];
-						int heightmap_width = dict["width"];
-
-						if (heightmap_depth >= 2 && heightmap_width >= 2) {
-							const Vector<real_t> &map_data = dict["heights"];
-
-							Vector2 heightmap_gridsize(heightmap_width - 1, heightmap_depth - 1);
-							Vector3 start = Vector3(heightmap_gridsize.x, 0, heightmap_gridsize.y) * -0.5;
-
-							Vector<Vector3> vertex_array;
-							vertex_array.resize((heightmap_depth - 1) * (heightmap_width - 1) * 6);
-							Vector3 *vertex_array_ptrw = vertex_array.ptrw();
-							const real_t *map_data_ptr = map_data.ptr();
-							int vertex_index = 0;
-
-							for (int d = 0; d < heightmap_depth - 1; d++) {
-								for (int w = 0; w < heightmap_width - 1; w++) {
-									vertex_array_ptrw[vertex_index] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + w], d);
-									vertex_array_ptrw[vertex_index + 1] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
-									vertex_array_ptrw[vertex_index + 2] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
-									vertex_array_ptrw[vertex_index + 3] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
-									vertex_array_ptrw[vertex_index + 4] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + heightmap_width + w + 1], d + 1);
-									vertex_array_ptrw[vertex_index + 5] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
-									vertex_index += 6;
-								}
-							}
-							if (vertex_array.size() > 0) {
-								p_source_geometry_data->add_faces(vertex_array, shapes[i]);
-							}
-						}
-					} break;
-					default: {
-						WARN_PRINT("Unsupported collision shape type.");
-					} break;
-				}
+				NavMeshGeometryParseItem3D parse_item;
+				parse_item.xform = shapes[i];
+				parse_item.physics_shape_type = PhysicsServer3D::get_singleton()->shape_get_type(shape);
+				parse_item.physics_shape_data = PhysicsServer3D::get_singleton()->shape_get_data(shape);
+				r_parse_job.items.push_back(parse_item);
 			}
 		}
 	}
@@ -646,6 +533,230 @@ void NavMeshGenerator3D::generator_parse_navigationobstacle_node(const Ref<Navig
 	p_source_geometry_data->add_projected_obstruction(obstruction_shape_vertices, elevation, safe_scale.y * obstacle->get_height(), obstacle->get_carve_navigation_mesh());
 }
 
+void NavMeshGenerator3D::generator_parse_shape_item(NavMeshGeometryParseItem3D &r_parse_item) {
+	BoxShape3D *box = Object::cast_to<BoxShape3D>(*r_parse_item.shape);
+	if (box) {
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, box->get_size());
+		r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+	}
+
+	CapsuleShape3D *capsule = Object::cast_to<CapsuleShape3D>(*r_parse_item.shape);
+	if (capsule) {
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		CapsuleMesh::create_mesh_array(arr, capsule->get_radius(), capsule->get_height());
+		r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+	}
+
+	CylinderShape3D *cylinder = Object::cast_to<CylinderShape3D>(*r_parse_item.shape);
+	if (cylinder) {
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		CylinderMesh::create_mesh_array(arr, cylinder->get_radius(), cylinder->get_radius(), cylinder->get_height());
+		r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+	}
+
+	SphereShape3D *sphere = Object::cast_to<SphereShape3D>(*r_parse_item.shape);
+	if (sphere) {
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		SphereMesh::create_mesh_array(arr, sphere->get_radius(), sphere->get_radius() * 2.0);
+		r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+	}
+
+	ConcavePolygonShape3D *concave_polygon = Object::cast_to<ConcavePolygonShape3D>(*r_parse_item.shape);
+	if (concave_polygon) {
+		r_parse_item.geometry->add_faces(concave_polygon->get_faces(), r_parse_item.xform);
+	}
+
+	ConvexPolygonShape3D *convex_polygon = Object::cast_to<ConvexPolygonShape3D>(*r_parse_item.shape);
+	if (convex_polygon) {
+		Vector<Vector3> varr = Variant(convex_polygon->get_points());
+		Geometry3D::MeshData md;
+
+		Error err = ConvexHullComputer::convex_hull(varr, md);
+
+		if (err == OK) {
+			PackedVector3Array faces;
+
+			for (const Geometry3D::MeshData::Face &face : md.faces) {
+				for (uint32_t k = 2; k < face.indices.size(); ++k) {
+					faces.push_back(md.vertices[face.indices[0]]);
+					faces.push_back(md.vertices[face.indices[k - 1]]);
+					faces.push_back(md.vertices[face.indices[k]]);
+				}
+			}
+
+			r_parse_item.geometry->add_faces(faces, r_parse_item.xform);
+		}
+	}
+
+	HeightMapShape3D *heightmap_shape = Object::cast_to<HeightMapShape3D>(*r_parse_item.shape);
+	if (heightmap_shape) {
+		int heightmap_depth = heightmap_shape->get_map_depth();
+		int heightmap_width = heightmap_shape->get_map_width();
+
+		if (heightmap_depth >= 2 && heightmap_width >= 2) {
+			const Vector<real_t> &map_data = heightmap_shape->get_map_data();
+
+			Vector2 heightmap_gridsize(heightmap_width - 1, heightmap_depth - 1);
+			Vector3 start = Vector3(heightmap_gridsize.x, 0, heightmap_gridsize.y) * -0.5;
+
+			Vector<Vector3> vertex_array;
+			vertex_array.resize((heightmap_depth - 1) * (heightmap_width - 1) * 6);
+			Vector3 *vertex_array_ptrw = vertex_array.ptrw();
+			const real_t *map_data_ptr = map_data.ptr();
+			int vertex_index = 0;
+
+			for (int d = 0; d < heightmap_depth - 1; d++) {
+				for (int w = 0; w < heightmap_width - 1; w++) {
+					vertex_array_ptrw[vertex_index] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + w], d);
+					vertex_array_ptrw[vertex_index + 1] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
+					vertex_array_ptrw[vertex_index + 2] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
+					vertex_array_ptrw[vertex_index + 3] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
+					vertex_array_ptrw[vertex_index + 4] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + heightmap_width + w + 1], d + 1);
+					vertex_array_ptrw[vertex_index + 5] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
+					vertex_index += 6;
+				}
+			}
+			if (vertex_array.size() > 0) {
+				r_parse_item.geometry->add_faces(vertex_array, r_parse_item.xform);
+			}
+		}
+	}
+}
+
+#ifdef MODULE_GRIDMAP_ENABLED
+void NavMeshGenerator3D::generator_parse_physics_shape_item(NavMeshGeometryParseItem3D &r_parse_item) {
+	switch (r_parse_item.physics_shape_type) {
+		case PhysicsServer3D::SHAPE_SPHERE: {
+			real_t radius = r_parse_item.physics_shape_data;
+			Array arr;
+			arr.resize(RS::ARRAY_MAX);
+			SphereMesh::create_mesh_array(arr, radius, radius * 2.0);
+			r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+		} break;
+		case PhysicsServer3D::SHAPE_BOX: {
+			Vector3 extents = r_parse_item.physics_shape_data;
+			Array arr;
+			arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(arr, extents * 2.0);
+			r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+		} break;
+		case PhysicsServer3D::SHAPE_CAPSULE: {
+			Dictionary dict = r_parse_item.physics_shape_data;
+			real_t radius = dict["radius"];
+			real_t height = dict["height"];
+			Array arr;
+			arr.resize(RS::ARRAY_MAX);
+			CapsuleMesh::create_mesh_array(arr, radius, height);
+			r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+		} break;
+		case PhysicsServer3D::SHAPE_CYLINDER: {
+			Dictionary dict = r_parse_item.physics_shape_data;
+			real_t radius = dict["radius"];
+			real_t height = dict["height"];
+			Array arr;
+			arr.resize(RS::ARRAY_MAX);
+			CylinderMesh::create_mesh_array(arr, radius, radius, height);
+			r_parse_item.geometry->add_mesh_array(arr, r_parse_item.xform);
+		} break;
+		case PhysicsServer3D::SHAPE_CONVEX_POLYGON: {
+			PackedVector3Array vertices = r_parse_item.physics_shape_data;
+			Geometry3D::MeshData md;
+
+			Error err = ConvexHullComputer::convex_hull(vertices, md);
+
+			if (err == OK) {
+				PackedVector3Array faces;
+
+				for (const Geometry3D::MeshData::Face &face : md.faces) {
+					for (uint32_t k = 2; k < face.indices.size(); ++k) {
+						faces.push_back(md.vertices[face.indices[0]]);
+						faces.push_back(md.vertices[face.indices[k - 1]]);
+						faces.push_back(md.vertices[face.indices[k]]);
+					}
+				}
+
+				r_parse_item.geometry->add_faces(faces, r_parse_item.xform);
+			}
+		} break;
+		case PhysicsServer3D::SHAPE_CONCAVE_POLYGON: {
+			Dictionary dict = r_parse_item.physics_shape_data;
+			PackedVector3Array faces = Variant(dict["faces"]);
+			r_parse_item.geometry->add_faces(faces, r_parse_item.xform);
+		} break;
+		case PhysicsServer3D::SHAPE_HEIGHTMAP: {
+			Dictionary dict = r_parse_item.physics_shape_data;
+			///< dict( int:"width", int:"depth",float:"cell_size", float_array:"heights"
+			int heightmap_depth = dict["depth"];
+			int heightmap_width = dict["width"];
+
+			if (heightmap_depth >= 2 && heightmap_width >= 2) {
+				const Vector<real_t> &map_data = dict["heights"];
+
+				Vector2 heightmap_gridsize(heightmap_width - 1, heightmap_depth - 1);
+				Vector3 start = Vector3(heightmap_gridsize.x, 0, heightmap_gridsize.y) * -0.5;
+
+				Vector<Vector3> vertex_array;
+				vertex_array.resize((heightmap_depth - 1) * (heightmap_width - 1) * 6);
+				Vector3 *vertex_array_ptrw = vertex_array.ptrw();
+				const real_t *map_data_ptr = map_data.ptr();
+				int vertex_index = 0;
+
+				for (int d = 0; d < heightmap_depth - 1; d++) {
+					for (int w = 0; w < heightmap_width - 1; w++) {
+						vertex_array_ptrw[vertex_index] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + w], d);
+						vertex_array_ptrw[vertex_index + 1] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
+						vertex_array_ptrw[vertex_index + 2] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
+						vertex_array_ptrw[vertex_index + 3] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + w + 1], d);
+						vertex_array_ptrw[vertex_index + 4] = start + Vector3(w + 1, map_data_ptr[(heightmap_width * d) + heightmap_width + w + 1], d + 1);
+						vertex_array_ptrw[vertex_index + 5] = start + Vector3(w, map_data_ptr[(heightmap_width * d) + heightmap_width + w], d + 1);
+						vertex_index += 6;
+					}
+				}
+				if (vertex_array.size() > 0) {
+					r_parse_item.geometry->add_faces(vertex_array, r_parse_item.xform);
+				}
+			}
+		} break;
+		default: {
+			WARN_PRINT("Unsupported collision shape type.");
+		} break;
+	}
+}
+#endif // MODULE_GRIDMAP_ENABLED
+
+void NavMeshGenerator3D::generator_thread_parse_item(void *p_arg, uint32_t p_index) {
+	NavMeshGeometryParseJob3D *parse_job = static_cast<NavMeshGeometryParseJob3D *>(p_arg);
+	NavMeshGeometryParseItem3D &parse_item = parse_job->items[p_index];
+
+	parse_item.geometry.instantiate();
+	parse_item.geometry->root_node_transform = parse_job->root_node_transform;
+
+	for (const Array &surface_arrays : parse_item.mesh_surface_arrays) {
+		const Vector<int> mesh_indices = surface_arrays[Mesh::ARRAY_INDEX];
+		if (mesh_indices.is_empty()) {
+			// Surfaces without indices are plain triangle lists.
+			const PackedVector3Array mesh_vertices = surface_arrays[Mesh::ARRAY_VERTEX];
+			parse_item.geometry->add_faces(mesh_vertices, parse_item.xform);
+		} else {
+			parse_item.geometry->add_mesh_array(surface_arrays, parse_item.xform);
+		}
+	}
+
+	if (parse_item.shape.is_valid()) {
+		generator_parse_shape_item(parse_item);
+	}
+#ifdef MODULE_GRIDMAP_ENABLED
+	if (parse_item.physics_shape_type != PhysicsServer3D::SHAPE_CUSTOM) {
+		generator_parse_physics_shape_item(parse_item);
+	}
+#endif // MODULE_GRIDMAP_ENABLED
+}
+
 void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node) {
 	List<Node *> parse_nodes;
 
@@ -665,171 +776,168 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 
 	bool recurse_children = p_navigation_mesh->get_source_geometry_mode() != NavigationMesh::SOURCE_GEOMETRY_GROUPS_EXPLICIT;
 
-	for (Node *parse_node : parse_nodes) {
-		generator_parse_geometry_node(p_navigation_mesh, p_source_geometry_data, parse_node, recurse_children);
-	}
-}
+	// The SceneTree is only walked on the main thread, nodes just record their meshes and shapes.
+	// Turning those into triangles happens on worker threads afterwards.
+	const uint64_t gather_begin_usec = OS::get_singleton()->get_ticks_usec();
 
-void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
-	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
-		return;
-	}
+	NavMeshGeometryParseJob3D parse_job;
+	parse_job.root_node_transform = root_node_transform;
 
-	Vector<float> source_geometry_vertices;
-	Vector<int> source_geometry_indices;
-	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+	for (Node *parse_node : parse_nodes) {
+		generator_parse_geometry_node(p_navigation_mesh, p_source_geometry_data, parse_node, recurse_children, parse_job);
+	}
 
-	p_source_geometry_data->get_data(
-			source_geometry_vertices,
-			source_geometry_indices,
-			projected_obstructions);
+	const uint64_t triangles_begin_usec = OS::get_singleton()->get_ticks_usec();
 
-	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
-		return;
+	const bool parse_on_threads = baking_use_multiple_threads && parse_job.items.size() > 1;
+	if (parse_on_threads) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_parse_item, &parse_job, parse_job.items.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorParse3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < parse_job.items.size(); i++) {
+			generator_thread_parse_item(&parse_job, i);
+		}
 	}
 
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
+	const uint64_t merge_begin_usec = OS::get_singleton()->get_ticks_usec();
 
-	// added to keep track of steps, no functionality right now
-	String bake_state = "";
+	for (const NavMeshGeometryParseItem3D &parse_item : parse_job.items) {
+		p_source_geometry_data->merge(parse_item.geometry);
+	}
 
-	bake_state = "Setting up Configuration..."; // step #1
+	const uint64_t merge_end_usec = OS::get_singleton()->get_ticks_usec();
 
-	const float *verts = source_geometry_vertices.ptr();
-	const int nverts = source_geometry_vertices.size() / 3;
-	const int *tris = source_geometry_indices.ptr();
-	const int ntris = source_geometry_indices.size() / 3;
+	print_verbose(vformat("NavMeshGenerator3D: Parsed %d source geometry items. Gather: %.2f ms, triangles: %.2f ms (%s), merge: %.2f ms.",
+			parse_job.items.size(),
+			(triangles_begin_usec - gather_begin_usec) / 1000.0,
+			(merge_begin_usec - triangles_begin_usec) / 1000.0,
+			parse_on_threads ? "worker threads" : "main thread",
+			(merge_end_usec - merge_begin_usec) / 1000.0));
+}
 
+static void _generator_setup_recast_config(const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, rcConfig &r_cfg) {
 	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
+	rcCalcBounds(p_verts, p_nverts, bmin, bmax);
 
-	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
+	memset(&r_cfg, 0, sizeof(r_cfg));
 
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
 	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+		r_cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / r_cfg.cs);
+	}
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
 
 	if (p_navigation_mesh->get_border_size() > 0.0 && Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
 		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
 		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
 		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
 		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
 		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
 		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
 		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
 		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
 	}
 	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
 		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
 	}
 
-	cfg.bmin[0] = bmin[0];
-	cfg.bmin[1] = bmin[1];
-	cfg.bmin[2] = bmin[2];
-	cfg.bmax[0] = bmax[0];
-	cfg.bmax[1] = bmax[1];
-	cfg.bmax[2] = bmax[2];
+	r_cfg.bmin[0] = bmin[0];
+	r_cfg.bmin[1] = bmin[1];
+	r_cfg.bmin[2] = bmin[2];
+	r_cfg.bmax[0] = bmax[0];
+	r_cfg.bmax[1] = bmax[1];
+	r_cfg.bmax[2] = bmax[2];
 
 	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
 	if (baking_aabb.has_volume()) {
 		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
-		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
-		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
-		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
-		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
-		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
-		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
+		r_cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
+		r_cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
+		r_cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
+		r_cfg.bmax[0] = r_cfg.bmin[0] + baking_aabb.size[0];
+		r_cfg.bmax[1] = r_cfg.bmin[1] + baking_aabb.size[1];
+		r_cfg.bmax[2] = r_cfg.bmin[2] + baking_aabb.size[2];
 	}
+}
 
-	bake_state = "Calculating grid size..."; // step #2
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+// Runs the Recast pipeline for the grid described by p_cfg and converts the result to native navigation mesh data.
+static bool _generator_build_recast_mesh(rcContext &p_ctx, const rcConfig &p_cfg, const Ref<NavigationMesh> &p_navigation_mesh, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
 
-	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
-		ERR_FAIL_MSG("Baking interrupted."
-					 "\nNavigationMesh baking process would likely crash the engine."
-					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
-					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
-					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
-					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
-		return;
-	}
+	// added to keep track of steps, no functionality right now
+	String bake_state = "";
 
 	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&p_ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
 	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&p_ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&p_ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&p_ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&p_ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&p_ctx, p_cfg.walkableHeight, *hf);
 	}
 
 	bake_state = "Constructing compact heightfield..."; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&p_ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -840,17 +948,17 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			const float *projected_obstruction_verts = projected_obstruction.vertices.ptr();
 			const int projected_obstruction_nverts = projected_obstruction.vertices.size() / 3;
 
-			rcMarkConvexPolyArea(&ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
+			rcMarkConvexPolyArea(&p_ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
 		}
 	}
 
 	bake_state = "Eroding walkable area..."; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&p_ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -861,37 +969,37 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			const float *projected_obstruction_verts = projected_obstruction.vertices.ptr();
 			const int projected_obstruction_nverts = projected_obstruction.vertices.size() / 3;
 
-			rcMarkConvexPolyArea(&ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
+			rcMarkConvexPolyArea(&p_ctx, projected_obstruction_verts, projected_obstruction_nverts, projected_obstruction.elevation, projected_obstruction.elevation + projected_obstruction.height, RC_NULL_AREA, *chf);
 		}
 	}
 
 	bake_state = "Partitioning..."; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&p_ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&p_ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&p_ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&p_ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
 	bake_state = "Creating contours..."; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&p_ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	bake_state = "Creating polymesh..."; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&p_ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&p_ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
@@ -900,9 +1008,6 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 
 	bake_state = "Converting to native navigation mesh..."; // step #10
 
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
-
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
 	recast_index_to_native_index.resize(detail_mesh->nverts);
@@ -915,7 +1020,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -939,12 +1044,10 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
 	bake_state = "Cleanup..."; // step #11
 
 	rcFreePolyMesh(poly_mesh);
@@ -953,6 +1056,396 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 	detail_mesh = nullptr;
 
 	bake_state = "Baking finished."; // step #12
+
+	return true;
+}
+
+// Returns the index of the seam between two tiles that p_value lies on, or -1 when it lies on no seam.
+static int _generator_get_tile_seam(float p_value, float p_grid_min, float p_tile_world_size, int p_tile_count, float p_tolerance) {
+	const int seam = (int)Math::round((p_value - p_grid_min) / p_tile_world_size);
+	if (seam <= 0 || seam >= p_tile_count) {
+		return -1;
+	}
+	if (Math::abs(p_value - (p_grid_min + seam * p_tile_world_size)) > p_tolerance) {
+		return -1;
+	}
+	return seam - 1;
+}
+
+struct NavMeshTileSeamVertex3D {
+	// Position along the seam.
+	float position = 0.0;
+	int index = -1;
+
+	bool operator<(const NavMeshTileSeamVertex3D &p_other) const { return position < p_other.position; }
+};
+
+// Appends the vertices of p_seam that lie on the seam edge from p_from to p_to, in edge order.
+static void _generator_split_tile_seam_edge(const LocalVector<NavMeshTileSeamVertex3D> &p_seam, const Vector<Vector3> &p_vertices, int p_from, int p_to, int p_axis, float p_tolerance, float p_height_tolerance, Vector<int> &r_polygon) {
+	const Vector3 &from = p_vertices[p_from];
+	const Vector3 &to = p_vertices[p_to];
+	const float min_position = MIN(from[p_axis], to[p_axis]) + p_tolerance;
+	const float max_position = MAX(from[p_axis], to[p_axis]) - p_tolerance;
+	if (min_position >= max_position) {
+		return;
+	}
+
+	uint32_t begin = 0;
+	uint32_t end = p_seam.size();
+	while (begin < end) {
+		const uint32_t middle = (begin + end) / 2;
+		if (p_seam[middle].position <= min_position) {
+			begin = middle + 1;
+		} else {
+			end = middle;
+		}
+	}
+
+	const int split_begin = r_polygon.size();
+	for (uint32_t i = begin; i < p_seam.size() && p_seam[i].position < max_position; i++) {
+		const Vector3 &vertex = p_vertices[p_seam[i].index];
+		// Only split at vertices of the same floor.
+		const float weight = (vertex[p_axis] - from[p_axis]) / (to[p_axis] - from[p_axis]);
+		if (Math::abs(vertex.y - Math::lerp(from.y, to.y, weight)) > p_height_tolerance) {
+			continue;
+		}
+		r_polygon.push_back(p_seam[i].index);
+	}
+	if (from[p_axis] > to[p_axis]) {
+		for (int i = split_begin, j = r_polygon.size() - 1; i < j; i++, j--) {
+			SWAP(r_polygon.write[i], r_polygon.write[j]);
+		}
+	}
+}
+
+struct NavMeshGenerator3D::NavMeshTileBakeJob3D {
+	Ref<NavigationMesh> navigation_mesh;
+	// Configuration of the whole tile grid, each tile gets its own copy with the tile bounds.
+	rcConfig cfg;
+	int tile_cells = 0;
+	int tile_count_x = 0;
+
+	const float *verts = nullptr;
+	int nverts = 0;
+	const int *tris = nullptr;
+	int ntris = 0;
+	const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> *projected_obstructions = nullptr;
+
+	LocalVector<uint32_t> dirty_tiles;
+	// Source triangles overlapping each dirty tile, including the tile border.
+	LocalVector<LocalVector<int>> dirty_tile_triangles;
+	LocalVector<NavMeshBakeTile3D> *tiles = nullptr;
+};
+
+void NavMeshGenerator3D::generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshTileBakeJob3D *job = static_cast<NavMeshTileBakeJob3D *>(p_arg);
+
+	const uint32_t tile_index = job->dirty_tiles[p_index];
+	NavMeshBakeTile3D &tile = (*job->tiles)[tile_index];
+	tile.vertices.clear();
+	tile.polygons.clear();
+
+	const LocalVector<int> &tile_triangles = job->dirty_tile_triangles[p_index];
+	if (tile_triangles.is_empty()) {
+		return;
+	}
+
+	LocalVector<int> tile_tris;
+	tile_tris.resize(tile_triangles.size() * 3);
+	for (uint32_t i = 0; i < tile_triangles.size(); i++) {
+		const int *tri = &job->tris[tile_triangles[i] * 3];
+		tile_tris[i * 3 + 0] = tri[0];
+		tile_tris[i * 3 + 1] = tri[1];
+		tile_tris[i * 3 + 2] = tri[2];
+	}
+
+	const int tile_x = tile_index % job->tile_count_x;
+	const int tile_z = tile_index / job->tile_count_x;
+	const float tile_world_size = job->tile_cells * job->cfg.cs;
+	const float border_world_size = job->cfg.borderSize * job->cfg.cs;
+
+	rcConfig cfg = job->cfg;
+	cfg.width = job->tile_cells + cfg.borderSize * 2;
+	cfg.height = job->tile_cells + cfg.borderSize * 2;
+	cfg.bmin[0] = job->cfg.bmin[0] + tile_x * tile_world_size - border_world_size;
+	cfg.bmin[2] = job->cfg.bmin[2] + tile_z * tile_world_size - border_world_size;
+	cfg.bmax[0] = job->cfg.bmin[0] + (tile_x + 1) * tile_world_size + border_world_size;
+	cfg.bmax[2] = job->cfg.bmin[2] + (tile_z + 1) * tile_world_size + border_world_size;
+
+	rcContext ctx;
+	if (!_generator_build_recast_mesh(ctx, cfg, job->navigation_mesh, job->verts, job->nverts, tile_tris.ptr(), tile_triangles.size(), *job->projected_obstructions, tile.vertices, tile.polygons)) {
+		tile.vertices.clear();
+		tile.polygons.clear();
+	}
+}
+
+void NavMeshGenerator3D::generator_bake_tiles(NavMeshTileBakeJob3D &p_job, const AABB &p_dirty_aabb) {
+	rcConfig &cfg = p_job.cfg;
+	_generator_setup_recast_config(p_job.navigation_mesh, p_job.verts, p_job.nverts, cfg);
+
+	// Same border as the Recast tile samples, wide enough that erosion and region building at the tile edges match the neighbor tiles.
+	cfg.borderSize = cfg.walkableRadius + 3;
+
+	p_job.tile_cells = MAX(1, (int)Math::ceil(p_job.navigation_mesh->get_tile_size() / cfg.cs));
+	if (!Math::is_equal_approx((float)p_job.tile_cells * cfg.cs, p_job.navigation_mesh->get_tile_size())) {
+		WARN_PRINT("Property tile_size is ceiled to cell_size voxel units and loses precision.");
+	}
+
+	int grid_width = 0;
+	int grid_height = 0;
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &grid_width, &grid_height);
+
+	NavMeshTileCache3D tile_cache;
+	tile_cache.tile_count_x = MAX(1, (grid_width + p_job.tile_cells - 1) / p_job.tile_cells);
+	tile_cache.tile_count_z = MAX(1, (grid_height + p_job.tile_cells - 1) / p_job.tile_cells);
+	p_job.tile_count_x = tile_cache.tile_count_x;
+
+	uint32_t config_hash = hash_murmur3_buffer(&cfg, sizeof(rcConfig));
+	config_hash = hash_murmur3_one_32(p_job.tile_cells, config_hash);
+	config_hash = hash_murmur3_one_32(p_job.navigation_mesh->get_sample_partition_type(), config_hash);
+	config_hash = hash_murmur3_one_32(p_job.navigation_mesh->get_filter_low_hanging_obstacles(), config_hash);
+	config_hash = hash_murmur3_one_32(p_job.navigation_mesh->get_filter_ledge_spans(), config_hash);
+	config_hash = hash_murmur3_one_32(p_job.navigation_mesh->get_filter_walkable_low_height_spans(), config_hash);
+	tile_cache.config_hash = hash_fmix32(config_hash);
+
+	const uint32_t tile_count = tile_cache.tile_count_x * tile_cache.tile_count_z;
+
+	// Tiles of a previous bake can only be kept when they were baked on the same grid with the same settings.
+	bool rebake_all_tiles = !p_dirty_aabb.has_surface();
+	const ObjectID navigation_mesh_id = p_job.navigation_mesh->get_instance_id();
+	tile_cache_mutex.lock();
+	NavMeshTileCache3D *previous_tile_cache = tile_caches.getptr(navigation_mesh_id);
+	if (previous_tile_cache && previous_tile_cache->config_hash == tile_cache.config_hash && previous_tile_cache->tiles.size() == tile_count) {
+		tile_cache.tiles = previous_tile_cache->tiles;
+	} else {
+		rebake_all_tiles = true;
+	}
+	tile_cache_mutex.unlock();
+
+	tile_cache.tiles.resize(tile_count);
+	p_job.tiles = &tile_cache.tiles;
+
+	const float tile_world_size = p_job.tile_cells * cfg.cs;
+	const float border_world_size = cfg.borderSize * cfg.cs;
+
+	LocalVector<int> tile_dirty_index;
+	tile_dirty_index.resize(tile_count);
+	for (uint32_t tile_index = 0; tile_index < tile_count; tile_index++) {
+		tile_dirty_index[tile_index] = -1;
+
+		const int tile_x = tile_index % tile_cache.tile_count_x;
+		const int tile_z = tile_index / tile_cache.tile_count_x;
+
+		AABB tile_aabb;
+		tile_aabb.position = Vector3(cfg.bmin[0] + tile_x * tile_world_size - border_world_size, cfg.bmin[1], cfg.bmin[2] + tile_z * tile_world_size - border_world_size);
+		tile_aabb.size = Vector3(tile_world_size + border_world_size * 2.0, cfg.bmax[1] - cfg.bmin[1], tile_world_size + border_world_size * 2.0);
+
+		if (rebake_all_tiles || tile_aabb.intersects_inclusive(p_dirty_aabb)) {
+			tile_dirty_index[tile_index] = p_job.dirty_tiles.size();
+			p_job.dirty_tiles.push_back(tile_index);
+		}
+	}
+
+	// Partition the source triangles by the tiles they overlap.
+	p_job.dirty_tile_triangles.resize(p_job.dirty_tiles.size());
+	for (int i = 0; i < p_job.ntris; i++) {
+		const float *v0 = &p_job.verts[p_job.tris[i * 3 + 0] * 3];
+		const float *v1 = &p_job.verts[p_job.tris[i * 3 + 1] * 3];
+		const float *v2 = &p_job.verts[p_job.tris[i * 3 + 2] * 3];
+		const float min_x = MIN(v0[0], MIN(v1[0], v2[0]));
+		const float max_x = MAX(v0[0], MAX(v1[0], v2[0]));
+		const float min_z = MIN(v0[2], MIN(v1[2], v2[2]));
+		const float max_z = MAX(v0[2], MAX(v1[2], v2[2]));
+
+		const int tile_x_begin = MAX(0, (int)Math::floor((min_x - cfg.bmin[0] - border_world_size) / tile_world_size));
+		const int tile_x_end = MIN(tile_cache.tile_count_x - 1, (int)Math::floor((max_x - cfg.bmin[0] + border_world_size) / tile_world_size));
+		const int tile_z_begin = MAX(0, (int)Math::floor((min_z - cfg.bmin[2] - border_world_size) / tile_world_size));
+		const int tile_z_end = MIN(tile_cache.tile_count_z - 1, (int)Math::floor((max_z - cfg.bmin[2] + border_world_size) / tile_world_size));
+
+		for (int tile_z = tile_z_begin; tile_z <= tile_z_end; tile_z++) {
+			for (int tile_x = tile_x_begin; tile_x <= tile_x_end; tile_x++) {
+				const int dirty_index = tile_dirty_index[tile_z * tile_cache.tile_count_x + tile_x];
+				if (dirty_index >= 0) {
+					p_job.dirty_tile_triangles[dirty_index].push_back(i);
+				}
+			}
+		}
+	}
+
+	if (baking_use_multiple_threads && p_job.dirty_tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&NavMeshGenerator3D::generator_thread_bake_tile, &p_job, p_job.dirty_tiles.size(), -1, baking_use_high_priority_threads, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < p_job.dirty_tiles.size(); i++) {
+			generator_thread_bake_tile(&p_job, i);
+		}
+	}
+
+	// Merge the tiles, vertices on shared tile edges are welded. Each tile simplifies its contours on its own,
+	// so a polygon edge on a seam can span several polygon edges of the neighbor tile. Those edges are split at
+	// the seam vertices of the neighbor tile, so the map can connect the polygons of both tiles.
+	const float seam_tolerance = cfg.cs * 0.1;
+	const float seam_height_tolerance = cfg.walkableClimb * cfg.ch + cfg.detailSampleMaxError;
+	const int seam_count_x = tile_cache.tile_count_x - 1;
+
+	Vector<Vector3> nav_vertices;
+	LocalVector<Vector<int>> tile_polygons;
+	HashMap<Vector3, int> tile_vertex_to_native_index;
+	LocalVector<int> tile_index_to_native_index;
+	// Seams between tile columns come first, then the seams between tile rows.
+	LocalVector<LocalVector<NavMeshTileSeamVertex3D>> seams;
+	seams.resize(seam_count_x + tile_cache.tile_count_z - 1);
+	LocalVector<int> vertex_seam_x;
+	LocalVector<int> vertex_seam_z;
+
+	for (const NavMeshBakeTile3D &tile : tile_cache.tiles) {
+		tile_index_to_native_index.resize(tile.vertices.size());
+		for (int i = 0; i < tile.vertices.size(); i++) {
+			// Tiles compute positions from their own bounds, snap vertices on seams to the exact same line.
+			Vector3 vertex = tile.vertices[i];
+			const int seam_x = _generator_get_tile_seam(vertex.x, cfg.bmin[0], tile_world_size, tile_cache.tile_count_x, seam_tolerance);
+			if (seam_x >= 0) {
+				vertex.x = cfg.bmin[0] + (seam_x + 1) * tile_world_size;
+			}
+			const int seam_z = _generator_get_tile_seam(vertex.z, cfg.bmin[2], tile_world_size, tile_cache.tile_count_z, seam_tolerance);
+			if (seam_z >= 0) {
+				vertex.z = cfg.bmin[2] + (seam_z + 1) * tile_world_size;
+			}
+
+			int *existing_index_ptr = tile_vertex_to_native_index.getptr(vertex);
+			if (!existing_index_ptr) {
+				int new_index = nav_vertices.size();
+				tile_index_to_native_index[i] = new_index;
+				tile_vertex_to_native_index[vertex] = new_index;
+				nav_vertices.push_back(vertex);
+
+				vertex_seam_x.push_back(seam_x);
+				vertex_seam_z.push_back(seam_z);
+				if (seam_x >= 0) {
+					seams[seam_x].push_back({ vertex.z, new_index });
+				}
+				if (seam_z >= 0) {
+					seams[seam_count_x + seam_z].push_back({ vertex.x, new_index });
+				}
+			} else {
+				tile_index_to_native_index[i] = *existing_index_ptr;
+			}
+		}
+
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			Vector<int> nav_indices;
+			nav_indices.resize(tile_polygon.size());
+			for (int i = 0; i < tile_polygon.size(); i++) {
+				nav_indices.write[i] = tile_index_to_native_index[tile_polygon[i]];
+			}
+			tile_polygons.push_back(nav_indices);
+		}
+	}
+
+	for (LocalVector<NavMeshTileSeamVertex3D> &seam : seams) {
+		seam.sort();
+	}
+
+	Vector<Vector<int>> nav_polygons;
+	nav_polygons.resize(tile_polygons.size());
+	for (uint32_t polygon_index = 0; polygon_index < tile_polygons.size(); polygon_index++) {
+		const Vector<int> &tile_polygon = tile_polygons[polygon_index];
+		Vector<int> &nav_polygon = nav_polygons.write[polygon_index];
+		for (int i = 0; i < tile_polygon.size(); i++) {
+			const int from = tile_polygon[i];
+			const int to = tile_polygon[(i + 1) % tile_polygon.size()];
+			nav_polygon.push_back(from);
+			if (vertex_seam_x[from] >= 0 && vertex_seam_x[from] == vertex_seam_x[to]) {
+				_generator_split_tile_seam_edge(seams[vertex_seam_x[from]], nav_vertices, from, to, Vector3::AXIS_Z, seam_tolerance, seam_height_tolerance, nav_polygon);
+			} else if (vertex_seam_z[from] >= 0 && vertex_seam_z[from] == vertex_seam_z[to]) {
+				_generator_split_tile_seam_edge(seams[seam_count_x + vertex_seam_z[from]], nav_vertices, from, to, Vector3::AXIS_X, seam_tolerance, seam_height_tolerance, nav_polygon);
+			}
+		}
+	}
+
+	p_job.navigation_mesh->set_data(nav_vertices, nav_polygons);
+
+	MutexLock tile_cache_lock(tile_cache_mutex);
+
+	// Drop the tiles of navigation meshes that no longer exist.
+	LocalVector<ObjectID> freed_navigation_mesh_ids;
+	for (const KeyValue<ObjectID, NavMeshTileCache3D> &E : tile_caches) {
+		if (ObjectDB::get_instance(E.key) == nullptr) {
+			freed_navigation_mesh_ids.push_back(E.key);
+		}
+	}
+	for (const ObjectID &freed_navigation_mesh_id : freed_navigation_mesh_ids) {
+		tile_caches.erase(freed_navigation_mesh_id);
+	}
+
+	tile_caches.insert(navigation_mesh_id, tile_cache);
+}
+
+void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb) {
+	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
+		return;
+	}
+
+	Vector<float> source_geometry_vertices;
+	Vector<int> source_geometry_indices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	p_source_geometry_data->get_data(
+			source_geometry_vertices,
+			source_geometry_indices,
+			projected_obstructions);
+
+	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
+		return;
+	}
+
+	const float *verts = source_geometry_vertices.ptr();
+	const int nverts = source_geometry_vertices.size() / 3;
+	const int *tris = source_geometry_indices.ptr();
+	const int ntris = source_geometry_indices.size() / 3;
+
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		NavMeshTileBakeJob3D job;
+		job.navigation_mesh = p_navigation_mesh;
+		job.verts = verts;
+		job.nverts = nverts;
+		job.tris = tris;
+		job.ntris = ntris;
+		job.projected_obstructions = &projected_obstructions;
+		generator_bake_tiles(job, p_dirty_aabb);
+		return;
+	}
+
+	tile_cache_mutex.lock();
+	tile_caches.erase(p_navigation_mesh->get_instance_id());
+	tile_cache_mutex.unlock();
+
+	rcContext ctx;
+
+	rcConfig cfg;
+	_generator_setup_recast_config(p_navigation_mesh, verts, nverts, cfg);
+
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+	// ~30000000 seems to be around sweetspot where Editor baking breaks
+	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh baking process would likely crash the engine."
+					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
+					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
+					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+		return;
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	if (!_generator_build_recast_mesh(ctx, cfg, p_navigation_mesh, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
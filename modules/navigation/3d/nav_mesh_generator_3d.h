@@ -38,6 +38,7 @@
 #include "core/templates/rid_owner.h"
 #include "modules/modules_enabled.gen.h" // For csg, gridmap.
 
+class Mesh;
 class Node;
 class NavigationMesh;
 class NavigationMeshSourceGeometryData3D;
@@ -71,6 +72,7 @@ class NavMeshGenerator3D : public Object {
 
 		Ref<NavigationMesh> navigation_mesh;
 		Ref<NavigationMeshSourceGeometryData3D> source_geometry_data;
+		AABB dirty_aabb;
 		Callable callback;
 		WorkerThreadPool::TaskID thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
 		NavMeshGeneratorTask3D::TaskStatus status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
@@ -79,21 +81,53 @@ class NavMeshGenerator3D : public Object {
 	static HashMap<WorkerThreadPool::TaskID, NavMeshGeneratorTask3D *> generator_tasks;
 
 	static void generator_thread_bake(void *p_arg);
+	static void generator_thread_bake_tile(void *p_arg, uint32_t p_index);
+
+	struct NavMeshBakeTile3D {
+		Vector<Vector3> vertices;
+		Vector<Vector<int>> polygons;
+	};
+
+	// Tiles of the last tiled bake of a navigation mesh, so later bakes only need to bake the changed tiles again.
+	struct NavMeshTileCache3D {
+		uint32_t config_hash = 0;
+		int tile_count_x = 0;
+		int tile_count_z = 0;
+		LocalVector<NavMeshBakeTile3D> tiles;
+	};
+
+	static Mutex tile_cache_mutex;
+	static HashMap<ObjectID, NavMeshTileCache3D> tile_caches;
+
+	struct NavMeshTileBakeJob3D;
 
 	static HashSet<Ref<NavigationMesh>> baking_navmeshes;
 
-	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children);
-	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
-	static void generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data);
+	struct NavMeshGeometryParseItem3D;
+	struct NavMeshGeometryParseJob3D;
 
-	static void generator_parse_meshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
-	static void generator_parse_multimeshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
-	static void generator_parse_staticbody3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
+	static void generator_thread_parse_item(void *p_arg, uint32_t p_index);
+	static void generator_get_mesh_surface_arrays(const Ref<Mesh> &p_mesh, LocalVector<Array> &r_surface_arrays);
+	static void generator_parse_shape_item(NavMeshGeometryParseItem3D &r_parse_item);
+#ifdef MODULE_GRIDMAP_ENABLED
+	static void generator_parse_physics_shape_item(NavMeshGeometryParseItem3D &r_parse_item);
+#endif // MODULE_GRIDMAP_ENABLED
+
+	static void generator_parse_geometry_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node, bool p_recurse_children, NavMeshGeometryParseJob3D &r_parse_job);
+	static void generator_parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node);
+	static void generator_bake(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback);
+	static void generator_bake_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback);
+	static void generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb = AABB());
+	static void generator_bake_tiles(NavMeshTileBakeJob3D &p_job, const AABB &p_dirty_aabb);
+
+	static void generator_parse_meshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node);
+	static void generator_parse_multimeshinstance3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node);
+	static void generator_parse_staticbody3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node);
 #ifdef MODULE_CSG_ENABLED
-	static void generator_parse_csgshape3d_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
+	static void generator_parse_csgshape3d_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node);
 #endif // MODULE_CSG_ENABLED
 #ifdef MODULE_GRIDMAP_ENABLED
-	static void generator_parse_gridmap_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
+	static void generator_parse_gridmap_node(const Ref<NavigationMesh> &p_navigation_mesh, NavMeshGeometryParseJob3D &r_parse_job, Node *p_node);
 #endif // MODULE_GRIDMAP_ENABLED
 	static void generator_parse_navigationobstacle_node(const Ref<NavigationMesh> &p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_node);
 
@@ -109,6 +143,8 @@ public:
 	static void parse_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
 	static void bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback = Callable());
+	static void rebake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable());
+	static void rebake_tiles_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable());
 	static bool is_baking(Ref<NavigationMesh> p_navigation_mesh);
 
 	static RID source_geometry_parser_create();
@@ -34,6 +34,7 @@
 
 #include "../nav_base.h"
 #include "../nav_map.h"
+#include "nav_map_hierarchy_3d.h"
 #include "nav_region_iteration_3d.h"
 
 #include "core/math/geometry_3d.h"
@@ -41,6 +42,18 @@
 
 #define THREE_POINTS_CROSS_PRODUCT(m_a, m_b, m_c) (((m_c) - (m_a)).cross((m_b) - (m_a)))
 
+struct HierarchySearchEntry {
+	real_t cost = 0.0;
+	uint32_t index = UINT32_MAX;
+};
+
+struct HierarchySearchEntryGreaterThan {
+	// Returns `true` if the cost of `a` is higher than that of `b`, the heap keeps the cheapest entry on top.
+	bool operator()(const HierarchySearchEntry &p_a, const HierarchySearchEntry &p_b) const {
+		return p_a.cost > p_b.cost;
+	}
+};
+
 bool NavMeshQueries3D::emit_callback(const Callable &p_callback) {
 	ERR_FAIL_COND_V(!p_callback.is_valid(), false);
 
@@ -224,12 +237,24 @@ void NavMeshQueries3D::query_task_polygons_get_path(NavMeshPathQueryTask3D &p_qu
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task, p_polygons);
+	const gd::Polygon *requested_end_polygon = p_query_task.end_polygon;
+	const bool path_corridor_cached = _query_task_restore_cached_path_corridor(p_query_task);
+
+	if (!path_corridor_cached) {
+		_query_task_build_hierarchy_corridor(p_query_task, p_polygons);
+
+		_query_task_build_path_corridor(p_query_task, p_polygons);
+	}
 
 	if (p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED) {
 		return;
 	}
 
+	// Only cache routes that reached the requested end polygon, the others depend on the exact target position.
+	if (!path_corridor_cached && p_query_task.end_polygon == requested_end_polygon) {
+		_query_task_cache_path_corridor(p_query_task);
+	}
+
 	// Post-Process path.
 	switch (p_query_task.path_postprocessing) {
 		case PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
@@ -271,6 +296,182 @@ void NavMeshQueries3D::query_task_polygons_get_path(NavMeshPathQueryTask3D &p_qu
 	p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED;
 }
 
+void NavMeshQueries3D::hierarchy_cluster_get_distances(const NavMapHierarchy3D &p_hierarchy, const LocalVector<gd::Polygon> &p_polygons, uint32_t p_cluster_id, uint32_t p_from_polygon_id, const Vector3 &p_from_position, LocalVector<real_t> &r_distances) {
+	const NavMapHierarchy3D::Cluster &cluster = p_hierarchy.clusters[p_cluster_id];
+
+	r_distances.resize(cluster.polygons.size());
+	for (real_t &distance : r_distances) {
+		distance = FLT_MAX;
+	}
+
+	// Dijkstra over the polygon centers, without leaving the cluster.
+	gd::Heap<HierarchySearchEntry, HierarchySearchEntryGreaterThan> open_polygons;
+
+	HierarchySearchEntry begin_entry;
+	begin_entry.index = p_hierarchy.polygon_cluster_indices[p_from_polygon_id];
+	begin_entry.cost = p_from_position.distance_to(p_hierarchy.polygon_centers[p_from_polygon_id]) * cluster.travel_cost;
+	r_distances[begin_entry.index] = begin_entry.cost;
+	open_polygons.push(begin_entry);
+
+	while (!open_polygons.is_empty()) {
+		const HierarchySearchEntry entry = open_polygons.pop();
+		if (entry.cost > r_distances[entry.index]) {
+			// Already reached through a cheaper route.
+			continue;
+		}
+
+		const uint32_t polygon_id = cluster.polygons[entry.index];
+		for (const gd::Edge &edge : p_polygons[polygon_id].edges) {
+			for (const gd::Edge::Connection &connection : edge.connections) {
+				const uint32_t neighbor_polygon_id = connection.polygon->id;
+				if (p_hierarchy.polygon_clusters[neighbor_polygon_id] != p_cluster_id) {
+					continue;
+				}
+
+				HierarchySearchEntry neighbor_entry;
+				neighbor_entry.index = p_hierarchy.polygon_cluster_indices[neighbor_polygon_id];
+				neighbor_entry.cost = entry.cost + p_hierarchy.polygon_centers[polygon_id].distance_to(p_hierarchy.polygon_centers[neighbor_polygon_id]) * cluster.travel_cost;
+				if (neighbor_entry.cost < r_distances[neighbor_entry.index]) {
+					r_distances[neighbor_entry.index] = neighbor_entry.cost;
+					open_polygons.push(neighbor_entry);
+				}
+			}
+		}
+	}
+}
+
+void NavMeshQueries3D::_query_task_build_hierarchy_corridor(NavMeshPathQueryTask3D &p_query_task, const LocalVector<gd::Polygon> &p_polygons) {
+	p_query_task.use_hierarchy_corridor = false;
+
+	const NavMapHierarchy3D *hierarchy = p_query_task.hierarchy;
+	if (hierarchy == nullptr || !hierarchy->enabled) {
+		return;
+	}
+
+	const uint32_t begin_cluster_id = hierarchy->polygon_clusters[p_query_task.begin_polygon->id];
+	const uint32_t end_cluster_id = hierarchy->polygon_clusters[p_query_task.end_polygon->id];
+	if (begin_cluster_id == end_cluster_id) {
+		// Short paths are cheap enough for the regular search.
+		return;
+	}
+
+	PathQuerySlot *path_query_slot = p_query_task.path_query_slot;
+	const uint32_t navigation_layers = p_query_task.navigation_layers;
+	const Vector3 end_position = p_query_task.end_position;
+
+	LocalVector<real_t> &begin_distances = path_query_slot->hierarchy_begin_distances;
+	LocalVector<real_t> &end_distances = path_query_slot->hierarchy_end_distances;
+	hierarchy_cluster_get_distances(*hierarchy, p_polygons, begin_cluster_id, p_query_task.begin_polygon->id, p_query_task.begin_position, begin_distances);
+	hierarchy_cluster_get_distances(*hierarchy, p_polygons, end_cluster_id, p_query_task.end_polygon->id, end_position, end_distances);
+
+	LocalVector<real_t> &portal_costs = path_query_slot->hierarchy_portal_costs;
+	LocalVector<uint32_t> &portal_parents = path_query_slot->hierarchy_portal_parents;
+	for (uint32_t i = 0; i < portal_costs.size(); i++) {
+		portal_costs[i] = FLT_MAX;
+		portal_parents[i] = UINT32_MAX;
+	}
+
+	// This is an implementation of the A* algorithm over the portals.
+	gd::Heap<HierarchySearchEntry, HierarchySearchEntryGreaterThan> open_portals;
+
+	auto portal_heuristic = [&](uint32_t p_portal_id) -> real_t {
+		return hierarchy->polygon_centers[hierarchy->portal_polygons[p_portal_id]].distance_to(end_position) * hierarchy->min_travel_cost;
+	};
+
+	auto reach_portal = [&](uint32_t p_portal_id, real_t p_cost, uint32_t p_parent_portal_id) {
+		if (p_cost >= portal_costs[p_portal_id]) {
+			return;
+		}
+		portal_costs[p_portal_id] = p_cost;
+		portal_parents[p_portal_id] = p_parent_portal_id;
+
+		HierarchySearchEntry entry;
+		entry.index = p_portal_id;
+		entry.cost = p_cost + portal_heuristic(p_portal_id);
+		open_portals.push(entry);
+	};
+
+	for (uint32_t portal_id : hierarchy->clusters[begin_cluster_id].portals) {
+		const real_t begin_distance = begin_distances[hierarchy->polygon_cluster_indices[hierarchy->portal_polygons[portal_id]]];
+		if (begin_distance != FLT_MAX) {
+			reach_portal(portal_id, begin_distance, UINT32_MAX);
+		}
+	}
+
+	real_t least_cost = FLT_MAX;
+	uint32_t least_cost_portal_id = UINT32_MAX;
+
+	while (!open_portals.is_empty()) {
+		const HierarchySearchEntry entry = open_portals.pop();
+		if (entry.cost >= least_cost) {
+			break;
+		}
+
+		const uint32_t portal_id = entry.index;
+		const real_t portal_cost = portal_costs[portal_id];
+		if (entry.cost > portal_cost + portal_heuristic(portal_id)) {
+			// Already reached through a cheaper route.
+			continue;
+		}
+
+		const uint32_t polygon_id = hierarchy->portal_polygons[portal_id];
+		const uint32_t cluster_id = hierarchy->polygon_clusters[polygon_id];
+		const NavMapHierarchy3D::Cluster &cluster = hierarchy->clusters[cluster_id];
+
+		if (cluster_id == end_cluster_id) {
+			const real_t end_distance = end_distances[hierarchy->polygon_cluster_indices[polygon_id]];
+			if (end_distance != FLT_MAX && portal_cost + end_distance < least_cost) {
+				least_cost = portal_cost + end_distance;
+				least_cost_portal_id = portal_id;
+			}
+		}
+
+		// Travel across the cluster to its other portals.
+		const uint32_t portal_count = cluster.portals.size();
+		const real_t *cluster_portal_costs = &cluster.portal_costs[hierarchy->portal_cluster_indices[portal_id] * portal_count];
+		for (uint32_t i = 0; i < portal_count; i++) {
+			if (cluster_portal_costs[i] != FLT_MAX && cluster.portals[i] != portal_id) {
+				reach_portal(cluster.portals[i], portal_cost + cluster_portal_costs[i], portal_id);
+			}
+		}
+
+		// Cross into the neighbor clusters.
+		for (const NavMapHierarchy3D::PortalEdge &portal_edge : hierarchy->portal_edges[portal_id]) {
+			const uint32_t neighbor_cluster_id = hierarchy->polygon_clusters[hierarchy->portal_polygons[portal_edge.portal]];
+			if ((navigation_layers & hierarchy->clusters[neighbor_cluster_id].navigation_layers) == 0) {
+				continue;
+			}
+			reach_portal(portal_edge.portal, portal_cost + portal_edge.cost, portal_id);
+		}
+	}
+
+	if (least_cost_portal_id == UINT32_MAX) {
+		// Leave unreachable targets to the regular search, it knows how to find the closest reachable polygon.
+		return;
+	}
+
+	// Restrict the polygon search to the clusters on the coarse route and their neighbors,
+	// which leaves the polygon search room to cut corners between clusters.
+	LocalVector<uint8_t> &corridor_clusters = path_query_slot->hierarchy_corridor_clusters;
+	memset(corridor_clusters.ptr(), 0, corridor_clusters.size());
+
+	auto add_corridor_cluster = [&](uint32_t p_cluster_id) {
+		const NavMapHierarchy3D::Cluster &cluster = hierarchy->clusters[p_cluster_id];
+		corridor_clusters[p_cluster_id] = 1;
+		for (uint32_t neighbor_cluster_id : cluster.neighbors) {
+			corridor_clusters[neighbor_cluster_id] = 1;
+		}
+	};
+
+	add_corridor_cluster(begin_cluster_id);
+	add_corridor_cluster(end_cluster_id);
+	for (uint32_t portal_id = least_cost_portal_id; portal_id != UINT32_MAX; portal_id = portal_parents[portal_id]) {
+		add_corridor_cluster(hierarchy->polygon_clusters[hierarchy->portal_polygons[portal_id]]);
+	}
+
+	p_query_task.use_hierarchy_corridor = true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const LocalVector<gd::Polygon> &p_polygons) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const uint32_t p_navigation_layers = p_query_task.navigation_layers;
@@ -279,6 +480,10 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	Vector3 begin_point = p_query_task.begin_position;
 	Vector3 end_point = p_query_task.end_position;
 
+	bool use_hierarchy_corridor = p_query_task.use_hierarchy_corridor;
+	const uint8_t *corridor_clusters = use_hierarchy_corridor ? p_query_task.path_query_slot->hierarchy_corridor_clusters.ptr() : nullptr;
+	const uint32_t *polygon_clusters = use_hierarchy_corridor ? p_query_task.hierarchy->polygon_clusters.ptr() : nullptr;
+
 	// Heap of polygons to travel next.
 	gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer>
 			&traversable_polys = p_query_task.path_query_slot->traversable_polys;
@@ -317,6 +522,11 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 					continue;
 				}
 
+				// Stay inside the clusters picked by the hierarchical search.
+				if (use_hierarchy_corridor && !corridor_clusters[polygon_clusters[connection.polygon->id]]) {
+					continue;
+				}
+
 				const gd::NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 				real_t poly_enter_cost = 0.0;
 				real_t poly_travel_cost = least_cost_poly.poly->owner->get_travel_cost();
@@ -372,6 +582,24 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (use_hierarchy_corridor) {
+				// The hierarchical corridor missed the route, search the whole map instead.
+				use_hierarchy_corridor = false;
+
+				for (gd::NavigationPoly &nav_poly : navigation_polys) {
+					nav_poly.reset();
+				}
+				navigation_polys[begin_poly->id].poly = begin_poly;
+
+				least_cost_id = begin_poly->id;
+				prev_least_cost_id = -1;
+
+				reachable_end = nullptr;
+				distance_to_reachable_end = FLT_MAX;
+
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -478,6 +706,64 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 	p_query_task.least_cost_id = least_cost_id;
 }
 
+bool NavMeshQueries3D::_query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task) {
+	PathCorridorCache *path_corridor_cache = p_query_task.path_corridor_cache;
+	if (path_corridor_cache == nullptr) {
+		return false;
+	}
+
+	PathCorridorCacheKey key;
+	key.map_iteration_id = p_query_task.map_iteration_id;
+	key.begin_polygon_id = p_query_task.begin_polygon->id;
+	key.end_polygon_id = p_query_task.end_polygon->id;
+	key.navigation_layers = p_query_task.navigation_layers;
+
+	LocalVector<gd::NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	MutexLock lock(path_corridor_cache->mutex);
+
+	const LocalVector<gd::NavigationPoly> *corridor = path_corridor_cache->corridors.getptr(key);
+	if (corridor == nullptr) {
+		return false;
+	}
+
+	// The post-processing only follows the back links from the end polygon, so only the corridor needs to be written.
+	for (const gd::NavigationPoly &corridor_poly : *corridor) {
+		navigation_polys[corridor_poly.poly->id] = corridor_poly;
+	}
+
+	gd::NavigationPoly &begin_navigation_poly = navigation_polys[p_query_task.begin_polygon->id];
+	begin_navigation_poly.entry = p_query_task.begin_position;
+	begin_navigation_poly.back_navigation_edge_pathway_start = p_query_task.begin_position;
+	begin_navigation_poly.back_navigation_edge_pathway_end = p_query_task.begin_position;
+
+	p_query_task.least_cost_id = p_query_task.end_polygon->id;
+	return true;
+}
+
+void NavMeshQueries3D::_query_task_cache_path_corridor(NavMeshPathQueryTask3D &p_query_task) {
+	PathCorridorCache *path_corridor_cache = p_query_task.path_corridor_cache;
+	if (path_corridor_cache == nullptr) {
+		return;
+	}
+
+	const LocalVector<gd::NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	LocalVector<gd::NavigationPoly> corridor;
+	for (int np_id = p_query_task.least_cost_id; np_id != -1; np_id = navigation_polys[np_id].back_navigation_poly_id) {
+		corridor.push_back(navigation_polys[np_id]);
+	}
+
+	PathCorridorCacheKey key;
+	key.map_iteration_id = p_query_task.map_iteration_id;
+	key.begin_polygon_id = p_query_task.begin_polygon->id;
+	key.end_polygon_id = p_query_task.end_polygon->id;
+	key.navigation_layers = p_query_task.navigation_layers;
+
+	MutexLock lock(path_corridor_cache->mutex);
+	path_corridor_cache->corridors.insert(key, corridor);
+}
+
 void NavMeshQueries3D::_query_task_simplified_path_points(NavMeshPathQueryTask3D &p_query_task) {
 	if (!p_query_task.simplify_path || p_query_task.path_points.size() <= 2) {
 		return;
@@ -35,6 +35,8 @@
 
 #include "../nav_utils.h"
 
+#include "core/os/mutex.h"
+#include "core/templates/lru.h"
 #include "servers/navigation/navigation_path_query_parameters_3d.h"
 #include "servers/navigation/navigation_path_query_result_3d.h"
 #include "servers/navigation/navigation_utilities.h"
@@ -42,16 +44,50 @@
 using namespace NavigationUtilities;
 
 class NavMap;
+struct NavMapHierarchy3D;
 
 class NavMeshQueries3D {
 public:
 	struct PathQuerySlot {
 		LocalVector<gd::NavigationPoly> path_corridor;
 		gd::Heap<gd::NavigationPoly *, gd::NavPolyTravelCostGreaterThan, gd::NavPolyHeapIndexer> traversable_polys;
+
+		// Hierarchical pathfinding state, sized for the portals and clusters of the map.
+		LocalVector<real_t> hierarchy_portal_costs;
+		LocalVector<uint32_t> hierarchy_portal_parents;
+		LocalVector<uint8_t> hierarchy_corridor_clusters;
+		LocalVector<real_t> hierarchy_begin_distances;
+		LocalVector<real_t> hierarchy_end_distances;
+
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
 
+	struct PathCorridorCacheKey {
+		uint32_t map_iteration_id = 0;
+		uint32_t begin_polygon_id = UINT32_MAX;
+		uint32_t end_polygon_id = UINT32_MAX;
+		uint32_t navigation_layers = 0;
+
+		static uint32_t hash(const PathCorridorCacheKey &p_key) {
+			uint32_t h = hash_murmur3_one_32(p_key.map_iteration_id);
+			h = hash_murmur3_one_32(p_key.begin_polygon_id, h);
+			h = hash_murmur3_one_32(p_key.end_polygon_id, h);
+			h = hash_murmur3_one_32(p_key.navigation_layers, h);
+			return hash_fmix32(h);
+		}
+
+		bool operator==(const PathCorridorCacheKey &p_key) const {
+			return map_iteration_id == p_key.map_iteration_id && begin_polygon_id == p_key.begin_polygon_id && end_polygon_id == p_key.end_polygon_id && navigation_layers == p_key.navigation_layers;
+		}
+	};
+
+	// Polygon corridors of previous queries, from the end polygon back to the begin polygon.
+	struct PathCorridorCache {
+		Mutex mutex;
+		LRUCache<PathCorridorCacheKey, LocalVector<gd::NavigationPoly>, PathCorridorCacheKey> corridors;
+	};
+
 	struct NavMeshPathQueryTask3D {
 		enum TaskStatus {
 			QUERY_STARTED,
@@ -82,6 +118,10 @@ public:
 		Vector3 map_up;
 		NavMap *map = nullptr;
 		PathQuerySlot *path_query_slot = nullptr;
+		const NavMapHierarchy3D *hierarchy = nullptr;
+		bool use_hierarchy_corridor = false;
+		PathCorridorCache *path_corridor_cache = nullptr;
+		uint32_t map_iteration_id = 0;
 
 		// Path points.
 		LocalVector<Vector3> path_points;
@@ -119,12 +159,17 @@ public:
 	static gd::ClosestPointQueryResult polygons_get_closest_point_info(const LocalVector<gd::Polygon> &p_polygons, const Vector3 &p_point);
 	static RID polygons_get_closest_point_owner(const LocalVector<gd::Polygon> &p_polygons, const Vector3 &p_point);
 
+	static void hierarchy_cluster_get_distances(const NavMapHierarchy3D &p_hierarchy, const LocalVector<gd::Polygon> &p_polygons, uint32_t p_cluster_id, uint32_t p_from_polygon_id, const Vector3 &p_from_position, LocalVector<real_t> &r_distances);
+
 	static void map_query_path(NavMap *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
 
 	static void query_task_polygons_get_path(NavMeshPathQueryTask3D &p_query_task, const LocalVector<gd::Polygon> &p_polygons);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const gd::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const LocalVector<gd::Polygon> &p_polygons);
+	static void _query_task_build_hierarchy_corridor(NavMeshPathQueryTask3D &p_query_task, const LocalVector<gd::Polygon> &p_polygons);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const LocalVector<gd::Polygon> &p_polygons);
+	static bool _query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task);
+	static void _query_task_cache_path_corridor(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
@@ -41,6 +41,7 @@ struct NavRegionIteration : NavBaseIteration {
 	LocalVector<gd::Polygon> navmesh_polygons;
 	real_t surface_area = 0.0;
 	AABB bounds;
+	uint32_t region_iteration_id = 0;
 
 	const Transform3D &get_transform() const { return transform; }
 	const LocalVector<gd::Polygon> &get_navmesh_polygons() const { return navmesh_polygons; }
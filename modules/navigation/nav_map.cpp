@@ -140,41 +140,110 @@ gd::PointKey NavMap::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-void NavMap::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
-	if (iteration_id == 0) {
-		return;
-	}
+NavMeshQueries3D::PathQuerySlot *NavMap::_acquire_path_query_slot(NavMapIteration &p_map_iteration) {
+	p_map_iteration.path_query_slots_semaphore.wait();
 
-	GET_MAP_ITERATION();
-
-	map_iteration.path_query_slots_semaphore.wait();
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+			path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		p_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_V_MSG(path_query_slot, nullptr, "No unused NavMap path query slot found! This should never happen :(.");
+	}
 
+	return path_query_slot;
+}
+
+void NavMap::_release_path_query_slot(NavMapIteration &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	p_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	p_map_iteration.path_query_slots_semaphore.post();
+}
+
+void NavMap::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
+	if (iteration_id == 0) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	p_query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
 	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap path query slot found! This should never happen :(.");
+		return;
 	}
 
 	p_query_task.map_up = map_iteration.map_up;
+	p_query_task.hierarchy = map_iteration.hierarchy.enabled ? &map_iteration.hierarchy : nullptr;
+	p_query_task.path_corridor_cache = path_cache_size > 0 ? &path_corridor_cache : nullptr;
+	p_query_task.map_iteration_id = map_iteration.iteration_id;
 
 	NavMeshQueries3D::query_task_polygons_get_path(p_query_task, map_iteration.navmesh_polygons);
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
+	_release_path_query_slot(map_iteration, p_query_task.path_query_slot);
 	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+}
+
+void NavMap::query_path_batch(LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &r_query_tasks) {
+	if (iteration_id == 0 || r_query_tasks.is_empty()) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	PathQueryBatch batch;
+	batch.map_iteration = &map_iteration;
+	batch.query_tasks = &r_query_tasks;
+	batch.worker_count = MIN(map_iteration.path_query_slots.size(), r_query_tasks.size());
+
+	if (batch.worker_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap::_query_path_batch_worker, &batch, batch.worker_count, -1, true, SNAME("NavMapPathQueryBatch"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		_query_path_batch_worker(0, &batch);
+	}
+}
+
+void NavMap::_query_path_batch_worker(uint32_t p_worker_index, PathQueryBatch *p_batch) {
+	NavMapIteration &map_iteration = *p_batch->map_iteration;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &query_tasks = *p_batch->query_tasks;
+
+	// Every worker keeps one query slot for its whole share of the batch, reusing its search buffers.
+	// Acquiring waits for a slot, so this only fails if the slots are broken. Then the share is
+	// marked as failed, so the caller can tell it apart from queries that found no path.
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = _acquire_path_query_slot(map_iteration);
+	if (path_query_slot == nullptr) {
+		for (uint32_t i = p_worker_index; i < query_tasks.size(); i += p_batch->worker_count) {
+			query_tasks[i].path_clear();
+			query_tasks[i].status = NavMeshQueries3D::NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED;
+		}
+		return;
+	}
+
+	for (uint32_t i = p_worker_index; i < query_tasks.size(); i += p_batch->worker_count) {
+		NavMeshQueries3D::NavMeshPathQueryTask3D &query_task = query_tasks[i];
+		query_task.path_query_slot = path_query_slot;
+		query_task.map_up = map_iteration.map_up;
+		query_task.hierarchy = map_iteration.hierarchy.enabled ? &map_iteration.hierarchy : nullptr;
+		query_task.path_corridor_cache = path_cache_size > 0 ? &path_corridor_cache : nullptr;
+		query_task.map_iteration_id = map_iteration.iteration_id;
 
-	map_iteration.path_query_slots_semaphore.post();
+		NavMeshQueries3D::query_task_polygons_get_path(query_task, map_iteration.navmesh_polygons);
+
+		query_task.path_query_slot = nullptr;
+	}
+
+	_release_path_query_slot(map_iteration, path_query_slot);
 }
 
 Vector3 NavMap::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -431,6 +500,8 @@ void NavMap::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.use_hierarchical_pathfinding = get_use_hierarchical_pathfinding();
+	iteration_build.hierarchy_cluster_size = get_hierarchy_cluster_size();
 
 	uint32_t enabled_region_count = 0;
 	uint32_t enabled_link_count = 0;
@@ -513,9 +584,15 @@ void NavMap::_sync_iteration() {
 	// Finally ping-pong switch the iteration slot.
 	iteration_slot_rwlock.write_lock();
 	uint32_t next_iteration_slot_index = (iteration_slot_index + 1) % 2;
+	iteration_slots[next_iteration_slot_index].iteration_id = iteration_id;
 	iteration_slot_index = next_iteration_slot_index;
 	iteration_slot_rwlock.write_unlock();
 
+	// Cached corridors of older iterations can no longer be hit.
+	path_corridor_cache.mutex.lock();
+	path_corridor_cache.corridors.clear();
+	path_corridor_cache.mutex.unlock();
+
 	iteration_ready = false;
 }
 
@@ -898,12 +975,48 @@ bool NavMap::get_use_async_iterations() const {
 	return use_async_iterations;
 }
 
+void NavMap::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	iteration_dirty = true;
+}
+
+void NavMap::set_path_cache_size(int p_size) {
+	p_size = MAX(p_size, 0);
+	if (path_cache_size == p_size) {
+		return;
+	}
+	path_cache_size = p_size;
+
+	path_corridor_cache.mutex.lock();
+	path_corridor_cache.corridors.clear();
+	if (path_cache_size > 0) {
+		path_corridor_cache.corridors.set_capacity(path_cache_size);
+	}
+	path_corridor_cache.mutex.unlock();
+}
+
+void NavMap::set_hierarchy_cluster_size(real_t p_cluster_size) {
+	p_cluster_size = MAX(p_cluster_size, NavigationDefaults3D::navmesh_cell_size_min);
+	if (hierarchy_cluster_size == p_cluster_size) {
+		return;
+	}
+	hierarchy_cluster_size = p_cluster_size;
+	iteration_dirty = true;
+}
+
 NavMap::NavMap() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
 
 	path_query_slots_max = GLOBAL_GET("navigation/pathfinding/max_threads");
 
+	use_hierarchical_pathfinding = GLOBAL_GET("navigation/pathfinding/use_hierarchical_pathfinding");
+	hierarchy_cluster_size = MAX(real_t(GLOBAL_GET("navigation/pathfinding/hierarchy_cluster_size")), NavigationDefaults3D::navmesh_cell_size_min);
+	set_path_cache_size(GLOBAL_GET("navigation/pathfinding/path_cache_size"));
+
 	int processor_count = OS::get_singleton()->get_processor_count();
 	if (path_query_slots_max < 0) {
 		path_query_slots_max = processor_count;
@@ -124,6 +124,12 @@ class NavMap : public NavRid {
 
 	bool use_async_iterations = true;
 
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchy_cluster_size = 16.0;
+
+	int path_cache_size = 0;
+	NavMeshQueries3D::PathCorridorCache path_corridor_cache;
+
 	uint32_t iteration_slot_index = 0;
 	LocalVector<NavMapIteration> iteration_slots;
 	mutable RWLock iteration_slot_rwlock;
@@ -137,6 +143,16 @@ class NavMap : public NavRid {
 	bool iteration_building = false;
 	bool iteration_ready = false;
 
+	struct PathQueryBatch {
+		NavMapIteration *map_iteration = nullptr;
+		LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> *query_tasks = nullptr;
+		uint32_t worker_count = 1;
+	};
+
+	NavMeshQueries3D::PathQuerySlot *_acquire_path_query_slot(NavMapIteration &p_map_iteration);
+	void _release_path_query_slot(NavMapIteration &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot);
+	void _query_path_batch_worker(uint32_t p_worker_index, PathQueryBatch *p_batch);
+
 	void _build_iteration();
 	void _sync_iteration();
 
@@ -183,6 +199,7 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void query_path_batch(LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D> &r_query_tasks);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -253,6 +270,15 @@ public:
 	void set_use_async_iterations(bool p_enabled);
 	bool get_use_async_iterations() const;
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const { return use_hierarchical_pathfinding; }
+
+	void set_hierarchy_cluster_size(real_t p_cluster_size);
+	real_t get_hierarchy_cluster_size() const { return hierarchy_cluster_size; }
+
+	void set_path_cache_size(int p_size);
+	int get_path_cache_size() const { return path_cache_size; }
+
 private:
 	void _sync_dirty_map_update_requests();
 	void _sync_dirty_avoidance_update_requests();
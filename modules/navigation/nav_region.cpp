@@ -159,6 +159,7 @@ void NavRegion::update_polygons() {
 	surface_area = 0.0;
 	bounds = AABB();
 	polygons_dirty = false;
+	iteration_id = iteration_id % UINT32_MAX + 1;
 
 	if (map == nullptr) {
 		return;
@@ -257,6 +258,7 @@ void NavRegion::get_iteration_update(NavRegionIteration &r_iteration) {
 	r_iteration.owner_use_edge_connections = get_use_edge_connections();
 	r_iteration.bounds = get_bounds();
 	r_iteration.surface_area = get_surface_area();
+	r_iteration.region_iteration_id = get_iteration_id();
 
 	r_iteration.navmesh_polygons.clear();
 	r_iteration.navmesh_polygons.resize(navmesh_polygons.size());
@@ -45,6 +45,9 @@ void NavigationAgent3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_target_desired_distance", "desired_distance"), &NavigationAgent3D::set_target_desired_distance);
 	ClassDB::bind_method(D_METHOD("get_target_desired_distance"), &NavigationAgent3D::get_target_desired_distance);
 
+	ClassDB::bind_method(D_METHOD("set_target_reuse_distance", "distance"), &NavigationAgent3D::set_target_reuse_distance);
+	ClassDB::bind_method(D_METHOD("get_target_reuse_distance"), &NavigationAgent3D::get_target_reuse_distance);
+
 	ClassDB::bind_method(D_METHOD("set_radius", "radius"), &NavigationAgent3D::set_radius);
 	ClassDB::bind_method(D_METHOD("get_radius"), &NavigationAgent3D::get_radius);
 
@@ -140,6 +143,7 @@ void NavigationAgent3D::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::VECTOR3, "target_position", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NO_EDITOR), "set_target_position", "get_target_position");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "path_desired_distance", PROPERTY_HINT_RANGE, "0.1,100,0.01,or_greater,suffix:m"), "set_path_desired_distance", "get_path_desired_distance");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "target_desired_distance", PROPERTY_HINT_RANGE, "0.1,100,0.01,or_greater,suffix:m"), "set_target_desired_distance", "get_target_desired_distance");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "target_reuse_distance", PROPERTY_HINT_RANGE, "0,100,0.01,or_greater,suffix:m"), "set_target_reuse_distance", "get_target_reuse_distance");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "path_height_offset", PROPERTY_HINT_RANGE, "-100.0,100,0.01,or_greater,suffix:m"), "set_path_height_offset", "get_path_height_offset");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "path_max_distance", PROPERTY_HINT_RANGE, "0.01,100,0.1,or_greater,suffix:m"), "set_path_max_distance", "get_path_max_distance");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "navigation_layers", PROPERTY_HINT_LAYERS_3D_NAVIGATION), "set_navigation_layers", "get_navigation_layers");
@@ -358,6 +362,9 @@ NavigationAgent3D::NavigationAgent3D() {
 	navigation_result = Ref<NavigationPathQueryResult3D>();
 	navigation_result.instantiate();
 
+	splice_result = Ref<NavigationPathQueryResult3D>();
+	splice_result.instantiate();
+
 #ifdef DEBUG_ENABLED
 	NavigationServer3D::get_singleton()->connect(SNAME("navigation_debug_changed"), callable_mp(this, &NavigationAgent3D::_navigation_debug_changed));
 #endif // DEBUG_ENABLED
@@ -542,6 +549,10 @@ void NavigationAgent3D::set_target_desired_distance(real_t p_target_desired_dist
 	target_desired_distance = p_target_desired_distance;
 }
 
+void NavigationAgent3D::set_target_reuse_distance(real_t p_distance) {
+	target_reuse_distance = MAX(p_distance, 0.0);
+}
+
 void NavigationAgent3D::set_radius(real_t p_radius) {
 	ERR_FAIL_COND_MSG(p_radius < 0.0, "Radius must be positive.");
 	if (Math::is_equal_approx(radius, p_radius)) {
@@ -647,6 +658,15 @@ void NavigationAgent3D::set_target_position(Vector3 p_position) {
 	target_position = p_position;
 	target_position_submitted = true;
 
+	// A target that only moved a little keeps the current path and only replaces its last segment.
+	const Vector<Vector3> &navigation_path = navigation_result->get_path();
+	if (target_reuse_distance > 0.0 && navigation_path.size() > 1 && navigation_path_index < navigation_path.size() - 1 && navigation_path[navigation_path.size() - 1].distance_to(p_position) <= target_reuse_distance) {
+		path_splice_requested = true;
+		target_reached = false;
+		navigation_finished = false;
+		return;
+	}
+
 	_request_repath();
 }
 
@@ -753,6 +773,8 @@ void NavigationAgent3D::_update_navigation() {
 		reload_path = true;
 	} else if (navigation_result->get_path().size() == 0) {
 		reload_path = true;
+	} else if (path_splice_requested && !_splice_path_to_target()) {
+		reload_path = true;
 	} else {
 		// Check if too far from the navigation path
 		if (navigation_path_index > 0) {
@@ -771,6 +793,8 @@ void NavigationAgent3D::_update_navigation() {
 		}
 	}
 
+	path_splice_requested = false;
+
 	if (reload_path) {
 		navigation_query->set_start_position(origin);
 		navigation_query->set_target_position(target_position);
@@ -836,7 +860,70 @@ void NavigationAgent3D::_advance_waypoints(const Vector3 &p_origin) {
 	}
 }
 
+bool NavigationAgent3D::_splice_path_to_target() {
+	path_splice_requested = false;
+
+	Vector<Vector3> navigation_path = navigation_result->get_path();
+	const int splice_index = navigation_path.size() - 2;
+	if (splice_index < navigation_path_index) {
+		// Already moving along the last segment, nothing left to keep.
+		return false;
+	}
+
+	navigation_query->set_start_position(navigation_path[splice_index]);
+	navigation_query->set_target_position(target_position);
+	navigation_query->set_navigation_layers(navigation_layers);
+	navigation_query->set_metadata_flags(path_metadata_flags);
+
+	if (map_override.is_valid()) {
+		navigation_query->set_map(map_override);
+	} else {
+		navigation_query->set_map(agent_parent->get_world_3d()->get_navigation_map());
+	}
+
+	NavigationServer3D::get_singleton()->query_path(navigation_query, splice_result);
+
+	const Vector<Vector3> &splice_path = splice_result->get_path();
+	if (splice_path.size() == 0) {
+		return false;
+	}
+
+	// The kept path ends with the splice waypoint, the spliced path starts with it.
+	navigation_path.resize(splice_index);
+	navigation_path.append_array(splice_path);
+	navigation_result->set_path(navigation_path);
+
+	if (path_metadata_flags.has_flag(NavigationPathQueryParameters3D::PATH_METADATA_INCLUDE_TYPES)) {
+		Vector<int32_t> path_types = navigation_result->get_path_types();
+		path_types.resize(splice_index);
+		path_types.append_array(splice_result->get_path_types());
+		navigation_result->set_path_types(path_types);
+	}
+
+	if (path_metadata_flags.has_flag(NavigationPathQueryParameters3D::PATH_METADATA_INCLUDE_RIDS)) {
+		TypedArray<RID> path_rids = navigation_result->get_path_rids();
+		path_rids.resize(splice_index);
+		path_rids.append_array(splice_result->get_path_rids());
+		navigation_result->set_path_rids(path_rids);
+	}
+
+	if (path_metadata_flags.has_flag(NavigationPathQueryParameters3D::PATH_METADATA_INCLUDE_OWNERS)) {
+		Vector<int64_t> path_owner_ids = navigation_result->get_path_owner_ids();
+		path_owner_ids.resize(splice_index);
+		path_owner_ids.append_array(splice_result->get_path_owner_ids());
+		navigation_result->set_path_owner_ids(path_owner_ids);
+	}
+
+#ifdef DEBUG_ENABLED
+	debug_path_dirty = true;
+#endif // DEBUG_ENABLED
+	last_waypoint_reached = false;
+	emit_signal(SNAME("path_changed"));
+	return true;
+}
+
 void NavigationAgent3D::_request_repath() {
+	path_splice_requested = false;
 	navigation_result->reset();
 	target_reached = false;
 	navigation_finished = false;
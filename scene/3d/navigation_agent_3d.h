@@ -57,6 +57,7 @@ class NavigationAgent3D : public Node {
 
 	real_t path_desired_distance = 1.0;
 	real_t target_desired_distance = 1.0;
+	real_t target_reuse_distance = 0.0;
 	real_t height = 1.0;
 	real_t radius = 0.5;
 	real_t path_height_offset = 0.0;
@@ -73,7 +74,9 @@ class NavigationAgent3D : public Node {
 
 	Ref<NavigationPathQueryParameters3D> navigation_query;
 	Ref<NavigationPathQueryResult3D> navigation_result;
+	Ref<NavigationPathQueryResult3D> splice_result;
 	int navigation_path_index = 0;
+	bool path_splice_requested = false;
 
 	// the velocity result of the avoidance simulation step
 	Vector3 safe_velocity;
@@ -164,6 +167,9 @@ public:
 	void set_target_desired_distance(real_t p_dd);
 	real_t get_target_desired_distance() const { return target_desired_distance; }
 
+	void set_target_reuse_distance(real_t p_distance);
+	real_t get_target_reuse_distance() const { return target_reuse_distance; }
+
 	void set_radius(real_t p_radius);
 	real_t get_radius() const { return radius; }
 
@@ -263,6 +269,7 @@ private:
 	void _update_navigation();
 	void _advance_waypoints(const Vector3 &p_origin);
 	void _request_repath();
+	bool _splice_path_to_target();
 
 	bool _is_last_waypoint() const;
 	void _move_to_next_waypoint();
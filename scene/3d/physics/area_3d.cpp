@@ -387,9 +387,12 @@ void Area3D::set_monitoring(bool p_enable) {
 	if (monitoring) {
 		PhysicsServer3D::get_singleton()->area_set_monitor_callback(get_rid(), callable_mp(this, &Area3D::_body_inout));
 		PhysicsServer3D::get_singleton()->area_set_area_monitor_callback(get_rid(), callable_mp(this, &Area3D::_area_inout));
+		// Servers that don't batch events ignore this, and keep calling the two callbacks above.
+		PhysicsServer3D::get_singleton()->area_set_monitor_batch_callback(get_rid(), callable_mp(this, &Area3D::_monitor_batch));
 	} else {
 		PhysicsServer3D::get_singleton()->area_set_monitor_callback(get_rid(), Callable());
 		PhysicsServer3D::get_singleton()->area_set_area_monitor_callback(get_rid(), Callable());
+		PhysicsServer3D::get_singleton()->area_set_monitor_batch_callback(get_rid(), Callable());
 		_clear_monitoring();
 	}
 }
@@ -424,6 +427,19 @@ void Area3D::_area_exit_tree(ObjectID p_id) {
 	}
 }
 
+void Area3D::_monitor_batch(const PackedInt64Array &p_body_events, const PackedInt64Array &p_area_events) {
+	// Same events as the ones sent to _body_inout() and _area_inout(), five values each.
+	const int64_t *body_events = p_body_events.ptr();
+	for (int i = 0; i + 4 < p_body_events.size() && monitoring; i += 5) {
+		_body_inout(body_events[i], RID::from_uint64(body_events[i + 1]), ObjectID(body_events[i + 2]), body_events[i + 3], body_events[i + 4]);
+	}
+
+	const int64_t *area_events = p_area_events.ptr();
+	for (int i = 0; i + 4 < p_area_events.size() && monitoring; i += 5) {
+		_area_inout(area_events[i], RID::from_uint64(area_events[i + 1]), ObjectID(area_events[i + 2]), area_events[i + 3], area_events[i + 4]);
+	}
+}
+
 void Area3D::_area_inout(int p_status, const RID &p_area, ObjectID p_instance, int p_area_shape, int p_self_shape) {
 	bool area_in = p_status == PhysicsServer3D::AREA_BODY_ADDED;
 	ObjectID objid = p_instance;
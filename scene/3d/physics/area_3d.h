@@ -101,6 +101,7 @@ private:
 	HashMap<ObjectID, BodyState> body_map;
 
 	void _area_inout(int p_status, const RID &p_area, ObjectID p_instance, int p_area_shape, int p_self_shape);
+	void _monitor_batch(const PackedInt64Array &p_body_events, const PackedInt64Array &p_area_events);
 
 	void _area_enter_tree(ObjectID p_id);
 	void _area_exit_tree(ObjectID p_id);
@@ -197,6 +197,12 @@ void NavigationMeshSourceGeometryData3D::_add_faces(const PackedVector3Array &p_
 void NavigationMeshSourceGeometryData3D::add_mesh(const Ref<Mesh> &p_mesh, const Transform3D &p_xform) {
 	ERR_FAIL_COND(p_mesh.is_null());
 
+	_warn_runtime_mesh_parsing();
+
+	_add_mesh(p_mesh, root_node_transform * p_xform);
+}
+
+void NavigationMeshSourceGeometryData3D::_warn_runtime_mesh_parsing() {
 #ifdef DEBUG_ENABLED
 	if (!Engine::get_singleton()->is_editor_hint()) {
 		WARN_PRINT_ONCE("Source geometry parsing for navigation mesh baking had to parse RenderingServer meshes at runtime.\n\
@@ -204,8 +210,6 @@ void NavigationMeshSourceGeometryData3D::add_mesh(const Ref<Mesh> &p_mesh, const
 		For runtime (re)baking navigation meshes use and parse collision shapes as source geometry or create geometry data procedurally in scripts.");
 	}
 #endif
-
-	_add_mesh(p_mesh, root_node_transform * p_xform);
 }
 
 void NavigationMeshSourceGeometryData3D::add_mesh_array(const Array &p_mesh_array, const Transform3D &p_xform) {
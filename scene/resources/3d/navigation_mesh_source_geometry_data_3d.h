@@ -61,6 +61,10 @@ private:
 	void _add_mesh_array(const Array &p_array, const Transform3D &p_xform);
 	void _add_faces(const PackedVector3Array &p_faces, const Transform3D &p_xform);
 
+	// The navigation mesh generator reads mesh surfaces itself, but should warn the same way.
+	friend class NavMeshGenerator3D;
+	static void _warn_runtime_mesh_parsing();
+
 public:
 	struct ProjectedObstruction {
 		static inline uint32_t VERSION = 1; // Increase when format changes so we can detect outdated formats and provide compatibility.
@@ -162,6 +162,15 @@ float NavigationMesh::get_border_size() const {
 	return border_size;
 }
 
+void NavigationMesh::set_tile_size(float p_value) {
+	ERR_FAIL_COND(p_value < 0);
+	tile_size = p_value;
+}
+
+float NavigationMesh::get_tile_size() const {
+	return tile_size;
+}
+
 void NavigationMesh::set_agent_height(float p_value) {
 	ERR_FAIL_COND(p_value < 0);
 	agent_height = p_value;
@@ -508,6 +517,9 @@ void NavigationMesh::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_border_size", "border_size"), &NavigationMesh::set_border_size);
 	ClassDB::bind_method(D_METHOD("get_border_size"), &NavigationMesh::get_border_size);
 
+	ClassDB::bind_method(D_METHOD("set_tile_size", "tile_size"), &NavigationMesh::set_tile_size);
+	ClassDB::bind_method(D_METHOD("get_tile_size"), &NavigationMesh::get_tile_size);
+
 	ClassDB::bind_method(D_METHOD("set_agent_height", "agent_height"), &NavigationMesh::set_agent_height);
 	ClassDB::bind_method(D_METHOD("get_agent_height"), &NavigationMesh::get_agent_height);
 
@@ -585,6 +597,7 @@ void NavigationMesh::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_size", PROPERTY_HINT_RANGE, "0.01,500.0,0.01,or_greater,suffix:m"), "set_cell_size", "get_cell_size");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_height", PROPERTY_HINT_RANGE, "0.01,500.0,0.01,or_greater,suffix:m"), "set_cell_height", "get_cell_height");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "border_size", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_border_size", "get_border_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "tile_size", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_tile_size", "get_tile_size");
 	ADD_GROUP("Agents", "agent_");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "agent_height", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_agent_height", "get_agent_height");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "agent_radius", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_agent_radius", "get_agent_radius");
@@ -206,6 +206,7 @@ void PhysicsServer3DExtension::_bind_methods() {
 
 	GDVIRTUAL_BIND(_area_set_monitor_callback, "area", "callback");
 	GDVIRTUAL_BIND(_area_set_area_monitor_callback, "area", "callback");
+	GDVIRTUAL_BIND(_area_set_monitor_batch_callback, "area", "callback");
 
 	/* BODY API */
 
@@ -283,6 +283,12 @@ public:
 	EXBIND2(area_set_monitor_callback, RID, const Callable &)
 	EXBIND2(area_set_area_monitor_callback, RID, const Callable &)
 
+	GDVIRTUAL2(_area_set_monitor_batch_callback, RID, const Callable &)
+
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) override {
+		GDVIRTUAL_CALL(_area_set_monitor_batch_callback, p_area, p_callback);
+	}
+
 	/* BODY API */
 
 	//EXBIND2RID(body,BodyMode,bool);
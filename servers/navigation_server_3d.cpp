@@ -53,6 +53,10 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_merge_rasterizer_cell_scale", "map"), &NavigationServer3D::map_get_merge_rasterizer_cell_scale);
 	ClassDB::bind_method(D_METHOD("map_set_use_edge_connections", "map", "enabled"), &NavigationServer3D::map_set_use_edge_connections);
 	ClassDB::bind_method(D_METHOD("map_get_use_edge_connections", "map"), &NavigationServer3D::map_get_use_edge_connections);
+	ClassDB::bind_method(D_METHOD("map_set_use_hierarchical_pathfinding", "map", "enabled"), &NavigationServer3D::map_set_use_hierarchical_pathfinding);
+	ClassDB::bind_method(D_METHOD("map_get_use_hierarchical_pathfinding", "map"), &NavigationServer3D::map_get_use_hierarchical_pathfinding);
+	ClassDB::bind_method(D_METHOD("map_set_hierarchy_cluster_size", "map", "cluster_size"), &NavigationServer3D::map_set_hierarchy_cluster_size);
+	ClassDB::bind_method(D_METHOD("map_get_hierarchy_cluster_size", "map"), &NavigationServer3D::map_get_hierarchy_cluster_size);
 	ClassDB::bind_method(D_METHOD("map_set_edge_connection_margin", "map", "margin"), &NavigationServer3D::map_set_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_get_edge_connection_margin", "map"), &NavigationServer3D::map_get_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer3D::map_set_link_connection_radius);
@@ -192,6 +196,8 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse_source_geometry_data", "navigation_mesh", "source_geometry_data", "root_node", "callback"), &NavigationServer3D::parse_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data_async, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("rebake_tiles_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "dirty_aabb", "callback"), &NavigationServer3D::rebake_tiles_from_source_geometry_data, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("rebake_tiles_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "dirty_aabb", "callback"), &NavigationServer3D::rebake_tiles_from_source_geometry_data_async, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("is_baking_navigation_mesh", "navigation_mesh"), &NavigationServer3D::is_baking_navigation_mesh);
 #endif // _3D_DISABLED
 
@@ -253,6 +259,9 @@ NavigationServer3D::NavigationServer3D() {
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_high_priority_threads", true);
 
 	GLOBAL_DEF("navigation/pathfinding/max_threads", 4);
+	GLOBAL_DEF("navigation/pathfinding/use_hierarchical_pathfinding", false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/pathfinding/hierarchy_cluster_size", PROPERTY_HINT_RANGE, "0.01,256,0.01,or_greater,suffix:m"), 16.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/pathfinding/path_cache_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
 
 	GLOBAL_DEF("navigation/baking/use_crash_prevention_checks", true);
 	GLOBAL_DEF("navigation/baking/thread_model/baking_use_multiple_threads", true);
@@ -90,6 +90,14 @@ public:
 	virtual void map_set_use_edge_connections(RID p_map, bool p_enabled) = 0;
 	virtual bool map_get_use_edge_connections(RID p_map) const = 0;
 
+	/// Set whether path queries on the map search a coarse graph of polygon clusters first.
+	virtual void map_set_use_hierarchical_pathfinding(RID p_map, bool p_enabled) = 0;
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const = 0;
+
+	/// Set the size of the grid cells used to group the map polygons into clusters.
+	virtual void map_set_hierarchy_cluster_size(RID p_map, real_t p_cluster_size) = 0;
+	virtual real_t map_get_hierarchy_cluster_size(RID p_map) const = 0;
+
 	/// Set the map edge connection margin used to weld the compatible region edges.
 	virtual void map_set_edge_connection_margin(RID p_map, real_t p_connection_margin) = 0;
 
@@ -105,6 +113,12 @@ public:
 	/// Returns the navigation path to reach the destination from the origin.
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) = 0;
 
+	/// Solves a batch of path queries in parallel. Every query takes a start and a target position
+	/// from `p_start_target_positions`, and one value from `p_navigation_layers` and `p_path_postprocessing`.
+	/// The path points of all queries are written one after another in `r_path_points`,
+	/// the number of points of each query in `r_path_point_counts`.
+	virtual void map_query_path_batch(RID p_map, const PackedVector3Array &p_start_target_positions, const PackedInt32Array &p_navigation_layers, const PackedInt32Array &p_path_postprocessing, PackedVector3Array &r_path_points, PackedInt32Array &r_path_point_counts) = 0;
+
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const = 0;
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const = 0;
 	virtual Vector3 map_get_closest_point_normal(RID p_map, const Vector3 &p_point) const = 0;
@@ -352,6 +366,8 @@ public:
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
+	virtual void rebake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) = 0;
+	virtual void rebake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) = 0;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const = 0;
 #endif // _3D_DISABLED
 
@@ -33,6 +33,7 @@
 #include "physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/templates/local_vector.h"
 #include "core/variant/typed_array.h"
 
 void PhysicsServer3DRenderingServerHandler::set_vertex(int p_vertex_id, const Vector3 &p_vertex) {
@@ -376,6 +377,77 @@ Dictionary PhysicsDirectSpaceState3D::_intersect_ray(const Ref<PhysicsRayQueryPa
 	return d;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to) {
+	ERR_FAIL_COND_V(p_ray_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V_MSG(p_from.size() != p_to.size(), Dictionary(), "The 'from' and 'to' arrays must have the same size.");
+
+	const int count = p_from.size();
+
+	LocalVector<RayResult> results;
+	LocalVector<bool> hits;
+	results.resize(count);
+	hits.resize(count);
+	// The server leaves the outputs untouched if the query fails, so they must read as misses.
+	for (int i = 0; i < count; i++) {
+		hits[i] = false;
+	}
+	intersect_ray_batch(p_ray_query->get_parameters(), p_from.ptr(), p_to.ptr(), count, results.ptr(), hits.ptr());
+
+	PackedByteArray hit;
+	PackedVector3Array position;
+	PackedVector3Array normal;
+	PackedInt32Array face_index;
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	Array rid;
+	hit.resize(count);
+	position.resize(count);
+	normal.resize(count);
+	face_index.resize(count);
+	collider_id.resize(count);
+	shape.resize(count);
+	rid.resize(count);
+
+	uint8_t *hit_ptr = hit.ptrw();
+	Vector3 *position_ptr = position.ptrw();
+	Vector3 *normal_ptr = normal.ptrw();
+	int32_t *face_index_ptr = face_index.ptrw();
+	int64_t *collider_id_ptr = collider_id.ptrw();
+	int32_t *shape_ptr = shape.ptrw();
+
+	for (int i = 0; i < count; i++) {
+		if (!hits[i]) {
+			hit_ptr[i] = 0;
+			position_ptr[i] = Vector3();
+			normal_ptr[i] = Vector3();
+			face_index_ptr[i] = -1;
+			collider_id_ptr[i] = 0;
+			shape_ptr[i] = 0;
+			rid[i] = RID();
+			continue;
+		}
+		const RayResult &result = results[i];
+		hit_ptr[i] = 1;
+		position_ptr[i] = result.position;
+		normal_ptr[i] = result.normal;
+		face_index_ptr[i] = result.face_index;
+		collider_id_ptr[i] = (int64_t)result.collider_id;
+		shape_ptr[i] = result.shape;
+		rid[i] = result.rid;
+	}
+
+	Dictionary d;
+	d["hit"] = hit;
+	d["position"] = position;
+	d["normal"] = normal;
+	d["face_index"] = face_index;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["rid"] = rid;
+
+	return d;
+}
+
 TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results) {
 	ERR_FAIL_COND_V(p_point_query.is_null(), TypedArray<Dictionary>());
 
@@ -421,6 +493,53 @@ TypedArray<Dictionary> PhysicsDirectSpaceState3D::_intersect_shape(const Ref<Phy
 	return ret;
 }
 
+Dictionary PhysicsDirectSpaceState3D::_intersect_shape_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results) {
+	ERR_FAIL_COND_V(p_shape_query.is_null(), Dictionary());
+	ERR_FAIL_COND_V(p_max_results <= 0, Dictionary());
+
+	const int count = p_transforms.size();
+
+	LocalVector<Transform3D> transforms;
+	transforms.resize(count);
+	for (int i = 0; i < count; i++) {
+		transforms[i] = p_transforms[i];
+	}
+
+	LocalVector<ShapeResult> results;
+	LocalVector<int> result_counts;
+	results.resize(count * p_max_results);
+	result_counts.resize(count);
+	// The server leaves the outputs untouched if the query fails, so they must read as empty.
+	for (int i = 0; i < count; i++) {
+		result_counts[i] = 0;
+	}
+	intersect_shape_batch(p_shape_query->get_parameters(), transforms.ptr(), count, results.ptr(), p_max_results, result_counts.ptr());
+
+	PackedInt32Array query;
+	PackedInt64Array collider_id;
+	PackedInt32Array shape;
+	Array rid;
+
+	for (int i = 0; i < count; i++) {
+		const ShapeResult *query_results = &results[i * p_max_results];
+		const int result_count = MIN(result_counts[i], p_max_results);
+		for (int j = 0; j < result_count; j++) {
+			query.push_back(i);
+			collider_id.push_back((int64_t)query_results[j].collider_id);
+			shape.push_back(query_results[j].shape);
+			rid.push_back(query_results[j].rid);
+		}
+	}
+
+	Dictionary d;
+	d["query"] = query;
+	d["collider_id"] = collider_id;
+	d["shape"] = shape;
+	d["rid"] = rid;
+
+	return d;
+}
+
 Vector<real_t> PhysicsDirectSpaceState3D::_cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query) {
 	ERR_FAIL_COND_V(p_shape_query.is_null(), Vector<real_t>());
 
@@ -478,10 +597,29 @@ Dictionary PhysicsDirectSpaceState3D::_get_rest_info(const Ref<PhysicsShapeQuery
 PhysicsDirectSpaceState3D::PhysicsDirectSpaceState3D() {
 }
 
+void PhysicsDirectSpaceState3D::intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits) {
+	RayParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.from = p_from[i];
+		parameters.to = p_to[i];
+		r_hits[i] = intersect_ray(parameters, r_results[i]);
+	}
+}
+
+void PhysicsDirectSpaceState3D::intersect_shape_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts) {
+	ShapeParameters parameters = p_parameters;
+	for (int i = 0; i < p_count; i++) {
+		parameters.transform = p_transforms[i];
+		r_result_counts[i] = intersect_shape(parameters, &r_results[i * p_result_max], p_result_max);
+	}
+}
+
 void PhysicsDirectSpaceState3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("intersect_point", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_point, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("intersect_ray", "parameters"), &PhysicsDirectSpaceState3D::_intersect_ray);
+	ClassDB::bind_method(D_METHOD("intersect_ray_batch", "parameters", "from", "to"), &PhysicsDirectSpaceState3D::_intersect_ray_batch);
 	ClassDB::bind_method(D_METHOD("intersect_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape, DEFVAL(32));
+	ClassDB::bind_method(D_METHOD("intersect_shape_batch", "parameters", "transforms", "max_results"), &PhysicsDirectSpaceState3D::_intersect_shape_batch, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("cast_motion", "parameters"), &PhysicsDirectSpaceState3D::_cast_motion);
 	ClassDB::bind_method(D_METHOD("collide_shape", "parameters", "max_results"), &PhysicsDirectSpaceState3D::_collide_shape, DEFVAL(32));
 	ClassDB::bind_method(D_METHOD("get_rest_info", "parameters"), &PhysicsDirectSpaceState3D::_get_rest_info);
@@ -749,6 +887,7 @@ void PhysicsServer3D::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("area_set_monitor_callback", "area", "callback"), &PhysicsServer3D::area_set_monitor_callback);
 	ClassDB::bind_method(D_METHOD("area_set_area_monitor_callback", "area", "callback"), &PhysicsServer3D::area_set_area_monitor_callback);
+	ClassDB::bind_method(D_METHOD("area_set_monitor_batch_callback", "area", "callback"), &PhysicsServer3D::area_set_monitor_batch_callback);
 	ClassDB::bind_method(D_METHOD("area_set_monitorable", "area", "monitorable"), &PhysicsServer3D::area_set_monitorable);
 
 	ClassDB::bind_method(D_METHOD("area_set_ray_pickable", "area", "enable"), &PhysicsServer3D::area_set_ray_pickable);
@@ -1100,6 +1239,8 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_ACTIVE_OBJECTS);
 	BIND_ENUM_CONSTANT(INFO_COLLISION_PAIRS);
 	BIND_ENUM_CONSTANT(INFO_ISLAND_COUNT);
+	BIND_ENUM_CONSTANT(INFO_TEMP_MEMORY_PEAK);
+	BIND_ENUM_CONSTANT(INFO_TEMP_MEMORY_CAPACITY);
 
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_RECYCLE_RADIUS);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_MAX_SEPARATION);
@@ -1109,6 +1250,8 @@ void PhysicsServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_BODY_TIME_TO_SLEEP);
 	BIND_ENUM_CONSTANT(SPACE_PARAM_SOLVER_ITERATIONS);
+	BIND_ENUM_CONSTANT(SPACE_PARAM_CONTACT_REUSE_THRESHOLD);
+	BIND_ENUM_CONSTANT(SPACE_PARAM_DETERMINISTIC);
 
 	BIND_ENUM_CONSTANT(BODY_AXIS_LINEAR_X);
 	BIND_ENUM_CONSTANT(BODY_AXIS_LINEAR_Y);
@@ -1138,6 +1281,8 @@ PhysicsServer3D::PhysicsServer3D() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_separation", PROPERTY_HINT_RANGE, "0,0.1,0.001,or_greater"), 0.05);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_max_allowed_penetration", PROPERTY_HINT_RANGE, "0.001,0.1,0.001,or_greater"), 0.01);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/default_contact_bias", PROPERTY_HINT_RANGE, "0,1,0.01"), 0.8);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "physics/3d/solver/contact_reuse_threshold", PROPERTY_HINT_RANGE, "0,0.1,0.0001,or_greater"), 0.0);
+	GLOBAL_DEF("physics/3d/solver/deterministic", false);
 }
 
 PhysicsServer3D::~PhysicsServer3D() {
@@ -122,8 +122,10 @@ class PhysicsDirectSpaceState3D : public Object {
 
 private:
 	Dictionary _intersect_ray(const Ref<PhysicsRayQueryParameters3D> &p_ray_query);
+	Dictionary _intersect_ray_batch(const Ref<PhysicsRayQueryParameters3D> &p_ray_query, const PackedVector3Array &p_from, const PackedVector3Array &p_to);
 	TypedArray<Dictionary> _intersect_point(const Ref<PhysicsPointQueryParameters3D> &p_point_query, int p_max_results = 32);
 	TypedArray<Dictionary> _intersect_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
+	Dictionary _intersect_shape_batch(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, const TypedArray<Transform3D> &p_transforms, int p_max_results = 32);
 	Vector<real_t> _cast_motion(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
 	TypedArray<Vector3> _collide_shape(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query, int p_max_results = 32);
 	Dictionary _get_rest_info(const Ref<PhysicsShapeQueryParameters3D> &p_shape_query);
@@ -205,6 +207,13 @@ public:
 
 	virtual Vector3 get_closest_point_to_object_volume(RID p_object, const Vector3 p_point) const = 0;
 
+	// Casts one ray per p_from/p_to pair, the rest of p_parameters is shared by all the rays.
+	// r_hits[i] tells whether ray i hit anything, in which case r_results[i] holds the hit.
+	virtual void intersect_ray_batch(const RayParameters &p_parameters, const Vector3 *p_from, const Vector3 *p_to, int p_count, RayResult *r_results, bool *r_hits);
+	// Runs one shape query per transform, the rest of p_parameters is shared by all the queries.
+	// Query i writes up to p_result_max results from r_results[i * p_result_max], and their amount to r_result_counts[i].
+	virtual void intersect_shape_batch(const ShapeParameters &p_parameters, const Transform3D *p_transforms, int p_count, ShapeResult *r_results, int p_result_max, int *r_result_counts);
+
 	PhysicsDirectSpaceState3D();
 };
 
@@ -294,6 +303,8 @@ public:
 		SPACE_PARAM_BODY_ANGULAR_VELOCITY_SLEEP_THRESHOLD,
 		SPACE_PARAM_BODY_TIME_TO_SLEEP,
 		SPACE_PARAM_SOLVER_ITERATIONS,
+		SPACE_PARAM_CONTACT_REUSE_THRESHOLD,
+		SPACE_PARAM_DETERMINISTIC,
 	};
 
 	virtual void space_set_param(RID p_space, SpaceParameter p_param, real_t p_value) = 0;
@@ -374,6 +385,8 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) = 0;
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) = 0;
+	// Optional, servers that don't batch monitor events keep calling the callbacks above.
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) {}
 
 	virtual void area_set_ray_pickable(RID p_area, bool p_enable) = 0;
 
@@ -805,7 +818,9 @@ public:
 	enum ProcessInfo {
 		INFO_ACTIVE_OBJECTS,
 		INFO_COLLISION_PAIRS,
-		INFO_ISLAND_COUNT
+		INFO_ISLAND_COUNT,
+		INFO_TEMP_MEMORY_PEAK,
+		INFO_TEMP_MEMORY_CAPACITY,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) = 0;
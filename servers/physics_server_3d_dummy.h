@@ -206,6 +206,7 @@ public:
 
 	virtual void area_set_monitor_callback(RID p_area, const Callable &p_callback) override {}
 	virtual void area_set_area_monitor_callback(RID p_area, const Callable &p_callback) override {}
+	virtual void area_set_monitor_batch_callback(RID p_area, const Callable &p_callback) override {}
 
 	virtual void area_set_ray_pickable(RID p_area, bool p_enable) override {}
 
@@ -46,11 +46,101 @@ void PhysicsServer3DWrapMT::_thread_loop() {
 	}
 }
 
+void PhysicsServer3DWrapMT::_thread_step(real_t p_delta) {
+	physics_server_3d->step(p_delta);
+
+	if (!pipelined) {
+		return;
+	}
+
+	HashMap<RID, BodyStateSnapshot> &back = body_states[front_body_states ^ 1];
+	back.clear();
+	for (const RID &body : tracked_bodies) {
+		BodyStateSnapshot &snapshot = back[body];
+		snapshot.transform = physics_server_3d->body_get_state(body, BODY_STATE_TRANSFORM);
+		snapshot.linear_velocity = physics_server_3d->body_get_state(body, BODY_STATE_LINEAR_VELOCITY);
+		snapshot.angular_velocity = physics_server_3d->body_get_state(body, BODY_STATE_ANGULAR_VELOCITY);
+		snapshot.sleeping = physics_server_3d->body_get_state(body, BODY_STATE_SLEEPING);
+		snapshot.can_sleep = physics_server_3d->body_get_state(body, BODY_STATE_CAN_SLEEP);
+	}
+	for (const RID &soft_body : tracked_soft_bodies) {
+		BodyStateSnapshot &snapshot = back[soft_body];
+		snapshot.transform = physics_server_3d->soft_body_get_state(soft_body, BODY_STATE_TRANSFORM);
+		snapshot.bounds = physics_server_3d->soft_body_get_bounds(soft_body);
+	}
+}
+
+Variant PhysicsServer3DWrapMT::_thread_body_get_state(RID p_body, BodyState p_state) const {
+	tracked_bodies.insert(p_body);
+	return physics_server_3d->body_get_state(p_body, p_state);
+}
+
+Variant PhysicsServer3DWrapMT::_thread_soft_body_get_state(RID p_body, BodyState p_state) const {
+	tracked_soft_bodies.insert(p_body);
+	return physics_server_3d->soft_body_get_state(p_body, p_state);
+}
+
+AABB PhysicsServer3DWrapMT::_thread_soft_body_get_bounds(RID p_body) const {
+	tracked_soft_bodies.insert(p_body);
+	return physics_server_3d->soft_body_get_bounds(p_body);
+}
+
+void PhysicsServer3DWrapMT::_thread_free(RID p_rid) {
+	// Untracked first, the RID may be reused by the next object created.
+	if (tracked_bodies.erase(p_rid) || tracked_soft_bodies.erase(p_rid)) {
+		body_states[front_body_states ^ 1].erase(p_rid);
+	}
+	physics_server_3d->free(p_rid);
+}
+
+const PhysicsServer3DWrapMT::BodyStateSnapshot *PhysicsServer3DWrapMT::_get_body_state_snapshot(RID p_body) const {
+	if (!step_in_flight) {
+		// Nothing to wait for, the server has the current state.
+		return nullptr;
+	}
+	return body_states[front_body_states].getptr(p_body);
+}
+
+Variant PhysicsServer3DWrapMT::BodyStateSnapshot::get(BodyState p_state) const {
+	switch (p_state) {
+		case BODY_STATE_TRANSFORM:
+			return transform;
+		case BODY_STATE_LINEAR_VELOCITY:
+			return linear_velocity;
+		case BODY_STATE_ANGULAR_VELOCITY:
+			return angular_velocity;
+		case BODY_STATE_SLEEPING:
+			return sleeping;
+		case BODY_STATE_CAN_SLEEP:
+			return can_sleep;
+	}
+	return Variant();
+}
+
+void PhysicsServer3DWrapMT::free(RID p_rid) {
+	if (Thread::get_caller_id() == server_thread) {
+		command_queue.flush_if_pending();
+		// The main thread may be reading the front snapshots, they are replaced at the next sync().
+		_thread_free(p_rid);
+		return;
+	}
+
+	if (pipelined) {
+		if (Thread::is_main_thread()) {
+			body_states[front_body_states].erase(p_rid);
+		}
+		command_queue.push(this, &PhysicsServer3DWrapMT::_thread_free, p_rid);
+	} else {
+		command_queue.push(physics_server_3d, &PhysicsServer3D::free, p_rid);
+	}
+}
+
 /* EVENT QUEUING */
 
 void PhysicsServer3DWrapMT::step(real_t p_step) {
 	if (create_thread) {
-		command_queue.push(physics_server_3d, &PhysicsServer3D::step, p_step);
+		command_queue.push(this, &PhysicsServer3DWrapMT::_thread_step, p_step);
+		step_in_flight = true;
 	} else {
 		physics_server_3d->step(p_step);
 	}
@@ -59,6 +149,11 @@ void PhysicsServer3DWrapMT::step(real_t p_step) {
 void PhysicsServer3DWrapMT::sync() {
 	if (create_thread) {
 		command_queue.sync();
+		if (pipelined && step_in_flight) {
+			// The server thread is idle, publish the snapshot of the step that just finished.
+			front_body_states ^= 1;
+		}
+		step_in_flight = false;
 	} else {
 		command_queue.flush_all(); // Flush all pending from other threads.
 	}
@@ -100,9 +195,10 @@ void PhysicsServer3DWrapMT::finish() {
 	}
 }
 
-PhysicsServer3DWrapMT::PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread) {
+PhysicsServer3DWrapMT::PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread, bool p_pipelined) {
 	physics_server_3d = p_contained;
 	create_thread = p_create_thread;
+	pipelined = p_create_thread && p_pipelined;
 }
 
 PhysicsServer3DWrapMT::~PhysicsServer3DWrapMT() {
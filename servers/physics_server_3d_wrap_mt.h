@@ -35,6 +35,8 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/thread.h"
 #include "core/templates/command_queue_mt.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
 #include "servers/physics_server_3d.h"
 
 #ifdef DEBUG_SYNC
@@ -61,10 +63,38 @@ class PhysicsServer3DWrapMT : public PhysicsServer3D {
 	bool exit = false;
 	bool create_thread = false;
 
+	struct BodyStateSnapshot {
+		Transform3D transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		AABB bounds; // Soft bodies only.
+		bool sleeping = false;
+		bool can_sleep = false;
+
+		Variant get(BodyState p_state) const;
+	};
+
+	// In pipelined mode, body and soft body state reads from the main thread don't wait for a step
+	// running on the server thread. They return a snapshot of the last completed step instead. A
+	// body is snapshotted after every step once it has been read for the first time. The server
+	// thread writes the back buffer, and `sync()` flips the buffers while the server thread is idle.
+	bool pipelined = false;
+	bool step_in_flight = false;
+	mutable HashSet<RID> tracked_bodies;
+	mutable HashSet<RID> tracked_soft_bodies;
+	HashMap<RID, BodyStateSnapshot> body_states[2];
+	uint32_t front_body_states = 0;
+
+	const BodyStateSnapshot *_get_body_state_snapshot(RID p_body) const;
+
 	void _assign_mt_ids(WorkerThreadPool::TaskID p_pump_task_id);
 	void _thread_exit();
 	void _thread_step(real_t p_delta);
 	void _thread_loop();
+	Variant _thread_body_get_state(RID p_body, BodyState p_state) const;
+	Variant _thread_soft_body_get_state(RID p_body, BodyState p_state) const;
+	AABB _thread_soft_body_get_bounds(RID p_body) const;
+	void _thread_free(RID p_rid);
 
 public:
 #define ServerName PhysicsServer3D
@@ -167,6 +197,7 @@ public:
 
 	FUNC2(area_set_monitor_callback, RID, const Callable &);
 	FUNC2(area_set_area_monitor_callback, RID, const Callable &);
+	FUNC2(area_set_monitor_batch_callback, RID, const Callable &);
 
 	/* BODY API */
 
@@ -216,7 +247,26 @@ public:
 	FUNC1(body_reset_mass_properties, RID);
 
 	FUNC3(body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, body_get_state, RID, BodyState);
+	virtual Variant body_get_state(RID p_body, BodyState p_state) const override {
+		if (Thread::get_caller_id() == server_thread) {
+			command_queue.flush_if_pending();
+			return physics_server_3d->body_get_state(p_body, p_state);
+		}
+
+		Variant ret;
+		if (pipelined && Thread::is_main_thread()) {
+			const BodyStateSnapshot *snapshot = _get_body_state_snapshot(p_body);
+			if (snapshot) {
+				return snapshot->get(p_state);
+			}
+			command_queue.push_and_ret(this, &PhysicsServer3DWrapMT::_thread_body_get_state, p_body, p_state, &ret);
+		} else {
+			command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::body_get_state, p_body, p_state, &ret);
+		}
+		SYNC_DEBUG
+		MAIN_THREAD_SYNC_CHECK
+		return ret;
+	}
 
 	FUNC2(body_apply_torque_impulse, RID, const Vector3 &);
 	FUNC2(body_apply_central_impulse, RID, const Vector3 &);
@@ -292,7 +342,27 @@ public:
 	FUNC2S(soft_body_get_collision_exceptions, RID, List<RID> *)
 
 	FUNC3(soft_body_set_state, RID, BodyState, const Variant &);
-	FUNC2RC(Variant, soft_body_get_state, RID, BodyState);
+	virtual Variant soft_body_get_state(RID p_body, BodyState p_state) const override {
+		if (Thread::get_caller_id() == server_thread) {
+			command_queue.flush_if_pending();
+			return physics_server_3d->soft_body_get_state(p_body, p_state);
+		}
+
+		Variant ret;
+		if (pipelined && Thread::is_main_thread()) {
+			// Soft bodies only have a transform, the other states are errors from the server.
+			const BodyStateSnapshot *snapshot = p_state == BODY_STATE_TRANSFORM ? _get_body_state_snapshot(p_body) : nullptr;
+			if (snapshot) {
+				return snapshot->transform;
+			}
+			command_queue.push_and_ret(this, &PhysicsServer3DWrapMT::_thread_soft_body_get_state, p_body, p_state, &ret);
+		} else {
+			command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::soft_body_get_state, p_body, p_state, &ret);
+		}
+		SYNC_DEBUG
+		MAIN_THREAD_SYNC_CHECK
+		return ret;
+	}
 
 	FUNC2(soft_body_set_transform, RID, const Transform3D &);
 
@@ -316,7 +386,26 @@ public:
 
 	FUNC2(soft_body_set_mesh, RID, RID);
 
-	FUNC1RC(AABB, soft_body_get_bounds, RID);
+	virtual AABB soft_body_get_bounds(RID p_body) const override {
+		if (Thread::get_caller_id() == server_thread) {
+			command_queue.flush_if_pending();
+			return physics_server_3d->soft_body_get_bounds(p_body);
+		}
+
+		AABB ret;
+		if (pipelined && Thread::is_main_thread()) {
+			const BodyStateSnapshot *snapshot = _get_body_state_snapshot(p_body);
+			if (snapshot) {
+				return snapshot->bounds;
+			}
+			command_queue.push_and_ret(this, &PhysicsServer3DWrapMT::_thread_soft_body_get_bounds, p_body, &ret);
+		} else {
+			command_queue.push_and_ret(physics_server_3d, &PhysicsServer3D::soft_body_get_bounds, p_body, &ret);
+		}
+		SYNC_DEBUG
+		MAIN_THREAD_SYNC_CHECK
+		return ret;
+	}
 
 	FUNC3(soft_body_move_point, RID, int, const Vector3 &);
 	FUNC2RC(Vector3, soft_body_get_point_global_position, RID, int);
@@ -379,7 +468,7 @@ public:
 
 	/* MISC */
 
-	FUNC1(free, RID);
+	virtual void free(RID p_rid) override;
 	FUNC1(set_active, bool);
 
 	virtual void init() override;
@@ -397,7 +486,7 @@ public:
 		return physics_server_3d->get_process_info(p_info);
 	}
 
-	PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread);
+	PhysicsServer3DWrapMT(PhysicsServer3D *p_contained, bool p_create_thread, bool p_pipelined = false);
 	~PhysicsServer3DWrapMT();
 
 #undef ServerNameWrapMT
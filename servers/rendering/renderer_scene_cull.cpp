@@ -2784,6 +2784,10 @@ void RendererSceneCull::_visibility_cull_threaded(uint32_t p_thread, VisibilityC
 	_visibility_cull(*cull_data, cull_data->cull_offset + bin_from, cull_data->cull_offset + bin_to);
 }
 
+void RendererSceneCull::_visibility_cull_bin(VisibilityCullData *cull_data) {
+	_visibility_cull(*cull_data, cull_data->cull_offset, cull_data->cull_offset + cull_data->cull_count);
+}
+
 void RendererSceneCull::_visibility_cull(const VisibilityCullData &cull_data, uint64_t p_from, uint64_t p_to) {
 	Scenario *scenario = cull_data.scenario;
 	for (unsigned int i = p_from; i < p_to; i++) {
@@ -3187,6 +3191,11 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 	RENDER_TIMESTAMP("Update Visibility Dependencies");
 
+	// Visibility dependencies only depend on the camera position, so when they are big enough to be threaded,
+	// they are resolved by a task graph while directional shadows and SDFGI regions are set up below.
+	LocalVector<VisibilityCullData> visibility_cull_bins;
+	WorkerThreadPool::TaskID visibility_cull_task = WorkerThreadPool::INVALID_TASK_ID;
+
 	if (scenario->instance_visibility.get_bin_count() > 0) {
 		if (!scenario->viewport_visibility_masks.has(p_viewport)) {
 			scenario_add_viewport_visibility_mask(scenario->self, p_viewport);
@@ -3197,6 +3206,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		visibility_cull_data.viewport_mask = scenario->viewport_visibility_masks[p_viewport];
 		visibility_cull_data.camera_position = camera_position;
 
+		bool use_threads = false;
 		for (int i = scenario->instance_visibility.get_bin_count() - 1; i > 0; i--) { // We skip bin 0
 			visibility_cull_data.cull_offset = scenario->instance_visibility.get_bin_start(i);
 			visibility_cull_data.cull_count = scenario->instance_visibility.get_bin_size(i);
@@ -3205,11 +3215,28 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 				continue;
 			}
 
-			if (visibility_cull_data.cull_count > thread_cull_threshold) {
-				WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererSceneCull::_visibility_cull_threaded, &visibility_cull_data, WorkerThreadPool::get_singleton()->get_thread_count(), -1, true, SNAME("VisibilityCullInstances"));
-				WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-			} else {
-				_visibility_cull(visibility_cull_data, visibility_cull_data.cull_offset, visibility_cull_data.cull_offset + visibility_cull_data.cull_count);
+			visibility_cull_bins.push_back(visibility_cull_data);
+			use_threads = use_threads || visibility_cull_data.cull_count > thread_cull_threshold;
+		}
+
+		if (use_threads) {
+			// Each bin depends on the flags of its parents, resolved by the previous bin, so bins form a chain.
+			WorkerThreadPool::TaskGraph graph;
+			for (uint32_t i = 0; i < visibility_cull_bins.size(); i++) {
+				uint32_t node;
+				if (visibility_cull_bins[i].cull_count > thread_cull_threshold) {
+					node = graph.add_template_group_task(this, &RendererSceneCull::_visibility_cull_threaded, &visibility_cull_bins[i], WorkerThreadPool::get_singleton()->get_thread_count());
+				} else {
+					node = graph.add_template_task(this, &RendererSceneCull::_visibility_cull_bin, &visibility_cull_bins[i]);
+				}
+				if (i > 0) {
+					graph.add_dependency(node - 1, node);
+				}
+			}
+			visibility_cull_task = WorkerThreadPool::get_singleton()->submit_task_graph(graph, true, SNAME("VisibilityCullInstances"));
+		} else {
+			for (const VisibilityCullData &bin : visibility_cull_bins) {
+				_visibility_cull(bin, bin.cull_offset, bin.cull_offset + bin.cull_count);
 			}
 		}
 	}
@@ -3284,6 +3311,10 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 		}
 	}
 
+	if (visibility_cull_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(visibility_cull_task);
+	}
+
 	scene_cull_result.clear();
 
 	{
@@ -0,0 +1,157 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/os/frame_arena.h"
+#include "core/templates/arena_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Allocation and alignment") {
+	FrameArena::Scope scope;
+	FrameArena *arena = FrameArena::get_thread_arena();
+	const size_t used = arena->get_used();
+
+	uint8_t *a = arena->alloc_array<uint8_t>(3);
+	uint64_t *b = arena->alloc_array<uint64_t>(4);
+	void *c = arena->alloc(16, 64);
+	CHECK(a != nullptr);
+	CHECK(((uintptr_t)b % alignof(uint64_t)) == 0);
+	CHECK(((uintptr_t)c % 64) == 0);
+	CHECK((uint8_t *)b >= a + 3);
+	CHECK(arena->get_used() > used);
+
+	for (int i = 0; i < 4; i++) {
+		b[i] = i;
+	}
+	CHECK(b[3] == 3);
+
+	// Allocations bigger than a chunk get a chunk of their own.
+	uint8_t *big = arena->alloc_array<uint8_t>(1024 * 1024);
+	big[1024 * 1024 - 1] = 42;
+	CHECK(big[1024 * 1024 - 1] == 42);
+	CHECK(arena->get_capacity() >= 1024 * 1024);
+}
+
+TEST_CASE("[FrameArena] Scopes rewind the arena") {
+	FrameArena *arena = FrameArena::get_thread_arena();
+	const size_t used = arena->get_used();
+	{
+		FrameArena::Scope scope;
+		arena->alloc(100);
+		const size_t outer_used = arena->get_used();
+		{
+			FrameArena::Scope inner_scope;
+			arena->alloc(1000);
+			arena->alloc(200 * 1024);
+		}
+		CHECK(arena->get_used() == outer_used);
+		CHECK(arena->get_used() >= used + 100);
+	}
+	CHECK(arena->get_used() == used);
+	CHECK(FrameArena::get_usage() >= used);
+}
+
+TEST_CASE("[FrameArena] Extending the last allocation") {
+	FrameArena::Scope scope;
+	FrameArena *arena = FrameArena::get_thread_arena();
+
+	void *first = arena->alloc(32);
+	CHECK(arena->extend(first, 32, 64));
+	void *second = arena->alloc(32);
+	CHECK((uint8_t *)second >= (uint8_t *)first + 64);
+	// Only the last allocation can grow in place.
+	CHECK_FALSE(arena->extend(first, 64, 128));
+	CHECK(arena->extend(second, 32, 48));
+}
+
+TEST_CASE("[ArenaVector] Push back and resize") {
+	FrameArena::Scope scope;
+
+	ArenaVector<int> vector;
+	CHECK(vector.is_empty());
+	for (int i = 0; i < 1000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 1000);
+	CHECK(vector.get_capacity() >= 1000);
+	bool ok = true;
+	for (int i = 0; i < 1000; i++) {
+		ok = ok && vector[i] == i;
+	}
+	CHECK(ok);
+
+	vector.remove_at_unordered(0);
+	CHECK(vector.size() == 999);
+	CHECK(vector[0] == 999);
+	CHECK(vector.has(500));
+	CHECK(vector.find(1000) == -1);
+
+	vector.resize(10);
+	CHECK(vector.size() == 10);
+	vector.clear();
+	CHECK(vector.is_empty());
+}
+
+TEST_CASE("[ArenaVector] Nested vectors") {
+	FrameArena::Scope scope;
+
+	ArenaVector<ArenaVector<uint32_t>> lists;
+	for (uint32_t i = 0; i < 64; i++) {
+		lists.resize(i + 1);
+		// Interleave growth between the lists so they can't all grow in place.
+		for (uint32_t j = 0; j <= i; j++) {
+			lists[j].push_back(i);
+		}
+	}
+
+	CHECK(lists.size() == 64);
+	CHECK(lists[0].size() == 64);
+	CHECK(lists[63].size() == 1);
+	CHECK(lists[63][0] == 63);
+	CHECK(lists[10][0] == 10);
+	CHECK(lists[10][53] == 63);
+
+	ArenaVector<uint32_t> moved = std::move(lists[0]);
+	CHECK(moved.size() == 64);
+	CHECK(lists[0].is_empty());
+
+	moved.sort();
+	CHECK(moved[0] == 0);
+	CHECK(moved[63] == 63);
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
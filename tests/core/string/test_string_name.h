@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*  test_string_name.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_STRING_NAME_H
+#define TEST_STRING_NAME_H
+
+#include "core/object/worker_thread_pool.h"
+#include "core/string/string_name.h"
+
+#include "tests/test_macros.h"
+
+namespace TestStringName {
+
+TEST_CASE("[StringName] Interning") {
+	const StringName from_cstr = StringName("interned_name");
+	const StringName from_string = StringName(String("interned_name"));
+	const StringName from_static = SNAME("interned_name");
+
+	CHECK(from_cstr == from_string);
+	CHECK(from_cstr == from_static);
+	CHECK(from_cstr.data_unique_pointer() == from_string.data_unique_pointer());
+	CHECK(StringName::search("interned_name") == from_cstr);
+	CHECK(StringName::search(String("interned_name")) == from_cstr);
+
+	CHECK(StringName("another_name") != from_cstr);
+	CHECK(StringName::search("never_interned_name_for_this_test") == StringName());
+	CHECK(StringName("").is_empty());
+}
+
+struct StringNameThreadTest {
+	static const int NAME_COUNT = 512;
+	static const int ITERATIONS = 64;
+
+	Vector<String> strings;
+	Vector<StringName> reference;
+	SafeNumeric<uint32_t> mismatches;
+
+	void test(uint32_t p_index, void *p_userdata) {
+		for (int i = 0; i < ITERATIONS; i++) {
+			// Shared names, interned by every thread at the same time.
+			int idx = (p_index * 31 + i * 7) % NAME_COUNT;
+			StringName name = StringName(strings[idx]);
+			if (name != reference[idx] || StringName::search(strings[idx]) != reference[idx]) {
+				mismatches.increment();
+			}
+
+			// Short lived names, created and released concurrently.
+			String unique = "thread_name_" + itos(p_index) + "_" + itos(i);
+			StringName first = StringName(unique);
+			StringName second = StringName(unique);
+			if (first != second || first != unique) {
+				mismatches.increment();
+			}
+		}
+	}
+};
+
+TEST_CASE("[StringName] Concurrent interning") {
+	StringNameThreadTest data;
+	for (int i = 0; i < StringNameThreadTest::NAME_COUNT; i++) {
+		String s = "shared_name_" + itos(i);
+		data.strings.push_back(s);
+		data.reference.push_back(StringName(s));
+	}
+
+	const int count = 256;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&data, &StringNameThreadTest::test, (void *)nullptr, count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(data.mismatches.get() == 0);
+
+	// Released names are removed from the table.
+	CHECK(StringName::search("thread_name_0_0") == StringName());
+
+	for (int i = 0; i < StringNameThreadTest::NAME_COUNT; i++) {
+		CHECK(StringName(data.strings[i]) == data.reference[i]);
+	}
+}
+
+struct StringNameBenchmark {
+	static const int LOOKUPS = 200000;
+
+	Vector<String> strings;
+
+	void lookup(uint32_t p_index, void *p_userdata) {
+		for (int i = 0; i < LOOKUPS; i++) {
+			// Mostly names that already exist, like property lookups do.
+			StringName name = StringName(strings[(p_index * 31 + i) % strings.size()]);
+		}
+	}
+};
+
+TEST_CASE_BENCHMARK("[Benchmark][StringName] Concurrent interning throughput") {
+	StringNameBenchmark data;
+	Vector<StringName> reference;
+	for (int i = 0; i < 4096; i++) {
+		String s = "benchmark_name_" + itos(i);
+		data.strings.push_back(s);
+		reference.push_back(StringName(s));
+	}
+
+	// With a table that doesn't serialize lookups, lookups per thread should stay about the same as threads are added.
+	const int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	for (int threads = 1; threads <= thread_count; threads *= 2) {
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_template_group_task(&data, &StringNameBenchmark::lookup, (void *)nullptr, threads, threads, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		const uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+		const double lookups_per_second = (double)threads * StringNameBenchmark::LOOKUPS * 1000000.0 / elapsed_usec;
+		MESSAGE(vformat("%d threads: %d lookups/s, %d lookups/s per thread.", threads, (int64_t)lookups_per_second, (int64_t)(lookups_per_second / threads)));
+	}
+}
+
+} // namespace TestStringName
+
+#endif // TEST_STRING_NAME_H
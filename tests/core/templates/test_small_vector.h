@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*  test_small_vector.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SMALL_VECTOR_H
+#define TEST_SMALL_VECTOR_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/small_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallVector {
+
+TEST_CASE("[SmallVector] List Initialization.") {
+	SmallVector<int, 4> vector{ 0, 1, 2 };
+
+	CHECK(vector.size() == 3);
+	CHECK(vector.is_inline());
+	CHECK(vector[0] == 0);
+	CHECK(vector[1] == 1);
+	CHECK(vector[2] == 2);
+}
+
+TEST_CASE("[SmallVector] Push back past the inline capacity.") {
+	SmallVector<int, 4> vector;
+	for (int i = 0; i < 4; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.is_inline());
+	CHECK(vector.get_capacity() == 4);
+
+	for (int i = 4; i < 20; i++) {
+		vector.push_back(i);
+	}
+	CHECK(!vector.is_inline());
+	CHECK(vector.size() == 20);
+	for (int i = 0; i < 20; i++) {
+		CHECK(vector[i] == i);
+	}
+
+	vector.reset();
+	CHECK(vector.is_empty());
+	CHECK(vector.is_inline());
+	CHECK(vector.get_capacity() == 4);
+}
+
+TEST_CASE("[SmallVector] Remove, insert, find.") {
+	SmallVector<int, 8> vector{ 3, 1, 4, 0, 2 };
+
+	CHECK(vector.find(4) == 2);
+	CHECK(vector.has(0));
+	CHECK(!vector.has(5));
+
+	vector.remove_at(0);
+	CHECK(vector.size() == 4);
+	CHECK(vector[0] == 1);
+	CHECK(vector[3] == 2);
+
+	vector.remove_at_unordered(0);
+	CHECK(vector.size() == 3);
+	CHECK(vector[0] == 2);
+
+	vector.insert(1, 7);
+	CHECK(vector[1] == 7);
+	CHECK(vector.erase(7));
+	CHECK(!vector.erase(7));
+
+	vector.sort();
+	CHECK(vector[0] == 0);
+	CHECK(vector[1] == 2);
+	CHECK(vector[2] == 4);
+}
+
+TEST_CASE("[SmallVector] Non-trivial elements.") {
+	SmallVector<String, 2> vector;
+	vector.push_back("a");
+	vector.push_back("b");
+	vector.push_back("c");
+	CHECK(!vector.is_inline());
+
+	vector.resize(5);
+	CHECK(vector[2] == "c");
+	CHECK(vector[4].is_empty());
+
+	vector.resize(1);
+	CHECK(vector.size() == 1);
+	CHECK(vector[0] == "a");
+}
+
+TEST_CASE("[SmallVector] Copy and move.") {
+	SmallVector<String, 2> inline_vector;
+	inline_vector.push_back("x");
+
+	SmallVector<String, 2> heap_vector;
+	for (int i = 0; i < 5; i++) {
+		heap_vector.push_back(itos(i));
+	}
+
+	SmallVector<String, 2> copy = heap_vector;
+	CHECK(copy.size() == 5);
+	CHECK(copy[4] == "4");
+	CHECK(heap_vector.size() == 5);
+
+	SmallVector<String, 2> moved_inline = std::move(inline_vector);
+	CHECK(moved_inline.is_inline());
+	CHECK(moved_inline.size() == 1);
+	CHECK(moved_inline[0] == "x");
+	CHECK(inline_vector.is_empty());
+
+	SmallVector<String, 2> moved_heap = std::move(heap_vector);
+	CHECK(!moved_heap.is_inline());
+	CHECK(moved_heap.size() == 5);
+	CHECK(heap_vector.is_empty());
+	CHECK(heap_vector.is_inline());
+
+	moved_heap = std::move(moved_inline);
+	CHECK(moved_heap.is_inline());
+	CHECK(moved_heap.size() == 1);
+	CHECK(moved_heap[0] == "x");
+
+	int sum = 0;
+	SmallVector<int, 4> numbers{ 1, 2, 3 };
+	for (int n : numbers) {
+		sum += n;
+	}
+	CHECK(sum == 6);
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[SmallVector] Inline elements don't allocate.") {
+	const uint64_t usage_before = Memory::get_mem_usage();
+
+	LocalVector<int> local;
+	for (int i = 0; i < 4; i++) {
+		local.push_back(i);
+	}
+	CHECK(Memory::get_mem_usage() > usage_before);
+	local.reset();
+
+	const uint64_t usage_inline = Memory::get_mem_usage();
+	SmallVector<int, 4> small;
+	for (int i = 0; i < 4; i++) {
+		small.push_back(i);
+	}
+	CHECK(Memory::get_mem_usage() == usage_inline);
+
+	small.push_back(4);
+	CHECK(Memory::get_mem_usage() > usage_inline);
+}
+#endif // DEBUG_ENABLED
+
+} // namespace TestSmallVector
+
+#endif // TEST_SMALL_VECTOR_H
@@ -107,6 +107,174 @@ TEST_CASE("[WorkerThreadPool] Process elements using group tasks") {
 	}
 }
 
+static void static_nested_group_test(void *p_arg, uint32_t p_index) {
+	counter[0].increment();
+}
+
+static void static_nested_test(void *p_arg) {
+	counter[1].increment();
+}
+
+static void static_spawning_group_test(void *p_arg, uint32_t p_index) {
+	// Submitted from a pool thread, so in work-stealing mode these go to the deque of this thread.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_nested_group_test, nullptr, 16, 4, true);
+	WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(static_nested_test, nullptr, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(task);
+}
+
+TEST_CASE("[WorkerThreadPool] Process nested tasks in work-stealing mode") {
+	const bool work_stealing_was_enabled = WorkerThreadPool::get_singleton()->is_work_stealing_enabled();
+	WorkerThreadPool::get_singleton()->set_work_stealing_enabled(true);
+
+	for (int iterations = 0; iterations < 100; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 6.0f));
+
+		counter.clear();
+		counter.resize(2);
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_spawning_group_test, nullptr, count, -1, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+		CHECK(counter[0].get() == count * 16);
+		CHECK(counter[1].get() == count);
+	}
+
+	WorkerThreadPool::get_singleton()->set_work_stealing_enabled(work_stealing_was_enabled);
+}
+
+TEST_CASE("[WorkerThreadPool] Process elements using group tasks in work-stealing mode") {
+	const bool work_stealing_was_enabled = WorkerThreadPool::get_singleton()->is_work_stealing_enabled();
+	WorkerThreadPool::get_singleton()->set_work_stealing_enabled(true);
+
+	for (int iterations = 0; iterations < 500; iterations++) {
+		const int count = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const int tasks = Math::pow(2.0f, Math::random(0.0f, 5.0f));
+		const bool low_priority = Math::rand() % 2;
+
+		counter.clear();
+		counter.resize(count);
+		WorkerThreadPool::GroupID group1 = WorkerThreadPool::get_singleton()->add_native_group_task(static_group_test, (void *)2, count, tasks, !low_priority);
+		WorkerThreadPool::GroupID group2 = WorkerThreadPool::get_singleton()->add_group_task(callable_mp_static(static_callable_group_test), count, tasks, low_priority);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group1);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group2);
+
+		bool all_run_once = true;
+		for (int i = 0; i < count; i++) {
+			//Reduce number of check messages
+			all_run_once &= counter[i].get() == 2;
+		}
+		CHECK(all_run_once);
+	}
+
+	WorkerThreadPool::get_singleton()->set_work_stealing_enabled(work_stealing_was_enabled);
+}
+
+static void static_benchmark_element(void *p_arg, uint32_t p_index) {
+	counter[0].increment();
+}
+
+static void static_benchmark_spawning_group(void *p_arg, uint32_t p_index) {
+	// Small nested groups, like the ones scene culling, physics islands and navigation sync post from pool threads.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_benchmark_element, nullptr, 32, 4, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+
+TEST_CASE_BENCHMARK("[Benchmark][WorkerThreadPool] Tasks per second with the global queue and with work stealing") {
+	const bool work_stealing_was_enabled = WorkerThreadPool::get_singleton()->is_work_stealing_enabled();
+	const int thread_count = WorkerThreadPool::get_singleton()->get_thread_count();
+	const int spawning_elements = 4096;
+
+	for (int threads = 1; threads <= thread_count; threads *= 2) {
+		double tasks_per_second[2] = {};
+		for (int work_stealing = 0; work_stealing < 2; work_stealing++) {
+			WorkerThreadPool::get_singleton()->set_work_stealing_enabled(work_stealing);
+
+			counter.clear();
+			counter.resize(1);
+			const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+			WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(static_benchmark_spawning_group, nullptr, spawning_elements, threads, true);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+			const uint64_t elapsed_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+			CHECK(counter[0].get() == spawning_elements * 32);
+			tasks_per_second[work_stealing] = (spawning_elements * 33) * 1000000.0 / elapsed_usec;
+		}
+		MESSAGE(vformat("%d threads: %d tasks/s with the global queue, %d tasks/s with work stealing.", threads, (int64_t)tasks_per_second[0], (int64_t)tasks_per_second[1]));
+	}
+
+	WorkerThreadPool::get_singleton()->set_work_stealing_enabled(work_stealing_was_enabled);
+}
+
+struct GraphTestNode {
+	LocalVector<uint32_t> predecessors;
+	int elements = 0; // Zero for single tasks.
+};
+static LocalVector<GraphTestNode> graph_test_nodes;
+static SafeFlag graph_order_broken;
+
+static void check_graph_predecessors_done(uint32_t p_node) {
+	for (uint32_t predecessor : graph_test_nodes[p_node].predecessors) {
+		if (counter[predecessor].get() != MAX(1, graph_test_nodes[predecessor].elements)) {
+			graph_order_broken.set();
+		}
+	}
+}
+
+static void static_graph_test(void *p_arg) {
+	check_graph_predecessors_done((uintptr_t)p_arg);
+	counter[(uintptr_t)p_arg].increment();
+}
+
+static void static_graph_group_test(void *p_arg, uint32_t p_index) {
+	check_graph_predecessors_done((uintptr_t)p_arg);
+	counter[(uintptr_t)p_arg].increment();
+}
+
+TEST_CASE("[WorkerThreadPool] Run task graphs respecting dependencies") {
+	for (int iterations = 0; iterations < 200; iterations++) {
+		const int count = 1 + Math::rand() % 32;
+
+		graph_order_broken.clear();
+		counter.clear();
+		counter.resize(count);
+		graph_test_nodes.clear();
+		graph_test_nodes.resize(count);
+
+		WorkerThreadPool::TaskGraph graph;
+		for (int i = 0; i < count; i++) {
+			graph_test_nodes[i].elements = Math::rand() % 2 ? 1 + Math::rand() % 64 : 0;
+			uint32_t node;
+			if (graph_test_nodes[i].elements) {
+				node = graph.add_native_group_task(static_graph_group_test, (void *)(uintptr_t)i, graph_test_nodes[i].elements);
+			} else {
+				node = graph.add_native_task(static_graph_test, (void *)(uintptr_t)i);
+			}
+			for (int j = 0; j < i; j++) {
+				if (Math::rand() % 4 == 0) {
+					graph.add_dependency(j, node);
+					graph_test_nodes[i].predecessors.push_back(j);
+				}
+			}
+		}
+
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->submit_task_graph(graph, Math::rand() % 2);
+		CHECK(graph.is_empty());
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
+
+		CHECK_FALSE_MESSAGE(graph_order_broken.is_set(), "No node should run before all its predecessors are complete.");
+		bool all_run = true;
+		for (int i = 0; i < count; i++) {
+			all_run &= counter[i].get() == MAX(1, graph_test_nodes[i].elements);
+		}
+		CHECK(all_run);
+	}
+
+	WorkerThreadPool::TaskGraph empty_graph;
+	WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->submit_task_graph(empty_graph);
+	CHECK(WorkerThreadPool::get_singleton()->is_task_completed(task_id));
+	CHECK(WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id) == OK);
+}
+
 static void static_test_daemon(void *p_arg) {
 	while (!exit.is_set()) {
 		counter[0].add(1);
@@ -34,6 +34,8 @@
 #include "scene/3d/navigation_agent_3d.h"
 #include "scene/3d/node_3d.h"
 #include "scene/main/window.h"
+#include "scene/resources/navigation_mesh.h"
+#include "servers/navigation_server_3d.h"
 
 #include "tests/test_macros.h"
 
@@ -64,6 +66,82 @@ TEST_SUITE("[Navigation]") {
 		memdelete(agent_node);
 		memdelete(node_3d);
 	}
+
+	TEST_CASE("[SceneTree][NavigationAgent3D] Close targets should reuse the path") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// An L-shaped corridor, so paths from the first leg to the second one bend at (2, 0, 10).
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Vector<Vector3> vertices;
+		vertices.push_back(Vector3(0, 0, 0));
+		vertices.push_back(Vector3(2, 0, 0));
+		vertices.push_back(Vector3(2, 0, 10));
+		vertices.push_back(Vector3(0, 0, 10));
+		vertices.push_back(Vector3(2, 0, 12));
+		vertices.push_back(Vector3(0, 0, 12));
+		vertices.push_back(Vector3(12, 0, 10));
+		vertices.push_back(Vector3(12, 0, 12));
+		navigation_mesh->set_vertices(vertices);
+		const int polygons[3][4] = { { 0, 1, 2, 3 }, { 3, 2, 4, 5 }, { 2, 6, 7, 4 } };
+		for (int i = 0; i < 3; i++) {
+			Vector<int> polygon;
+			for (int j = 0; j < 4; j++) {
+				polygon.push_back(polygons[i][j]);
+			}
+			navigation_mesh->add_polygon(polygon);
+		}
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+
+		Node3D *node_3d = memnew(Node3D);
+		SceneTree::get_singleton()->get_root()->add_child(node_3d);
+		node_3d->set_position(Vector3(1, 0, 1));
+		NavigationAgent3D *agent_node = memnew(NavigationAgent3D);
+		node_3d->add_child(agent_node);
+		agent_node->set_navigation_map(map);
+		agent_node->set_target_reuse_distance(1.0);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		agent_node->set_target_position(Vector3(11, 0, 11));
+		agent_node->get_next_path_position();
+		const Vector<Vector3> path = agent_node->get_current_navigation_path();
+		REQUIRE_EQ(path.size(), 3);
+		CHECK(path[0].is_equal_approx(Vector3(1, 0, 1)));
+		CHECK(path[1].is_equal_approx(Vector3(2, 0, 10)));
+
+		// A new path would start where the agent is now.
+		node_3d->set_position(Vector3(1, 0, 2));
+
+		SUBCASE("Targets within the reuse distance should only replace the last segment") {
+			agent_node->set_target_position(Vector3(11, 0, 11.5));
+			agent_node->get_next_path_position();
+			const Vector<Vector3> spliced_path = agent_node->get_current_navigation_path();
+			REQUIRE_GE(spliced_path.size(), 3);
+			CHECK(spliced_path[0].is_equal_approx(path[0]));
+			CHECK(spliced_path[1].is_equal_approx(path[1]));
+			CHECK(spliced_path[spliced_path.size() - 1].is_equal_approx(Vector3(11, 0, 11.5)));
+		}
+
+		SUBCASE("Targets beyond the reuse distance should query a new path") {
+			agent_node->set_target_position(Vector3(6, 0, 11));
+			agent_node->get_next_path_position();
+			const Vector<Vector3> new_path = agent_node->get_current_navigation_path();
+			REQUIRE_EQ(new_path.size(), 3);
+			CHECK(new_path[0].is_equal_approx(Vector3(1, 0, 2)));
+			CHECK(new_path[2].is_equal_approx(Vector3(6, 0, 11)));
+		}
+
+		memdelete(agent_node);
+		memdelete(node_3d);
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
 }
 
 } //namespace TestNavigationAgent3D
@@ -0,0 +1,57 @@
+/**************************************************************************/
+/*  physics_test_utils.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef PHYSICS_TEST_UTILS_H
+#define PHYSICS_TEST_UTILS_H
+
+#include "core/templates/hashfuncs.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rid.h"
+
+namespace PhysicsTestUtils {
+
+// Hashes the transforms and velocities of the bodies, to compare simulations bit for bit. Works
+// with both PhysicsServer2D and PhysicsServer3D.
+template <typename TPhysicsServer>
+uint32_t hash_body_states(const LocalVector<RID> &p_bodies) {
+	TPhysicsServer *ps = TPhysicsServer::get_singleton();
+
+	uint32_t hash = HASH_MURMUR3_SEED;
+	for (const RID &body : p_bodies) {
+		hash = hash_murmur3_one_32(ps->body_get_state(body, TPhysicsServer::BODY_STATE_TRANSFORM).hash(), hash);
+		hash = hash_murmur3_one_32(ps->body_get_state(body, TPhysicsServer::BODY_STATE_LINEAR_VELOCITY).hash(), hash);
+		hash = hash_murmur3_one_32(ps->body_get_state(body, TPhysicsServer::BODY_STATE_ANGULAR_VELOCITY).hash(), hash);
+	}
+	return hash_fmix32(hash);
+}
+
+} // namespace PhysicsTestUtils
+
+#endif // PHYSICS_TEST_UTILS_H
@@ -31,6 +31,8 @@
 #ifndef TEST_NAVIGATION_SERVER_3D_H
 #define TEST_NAVIGATION_SERVER_3D_H
 
+#include "core/config/project_settings.h"
+#include "core/os/os.h"
 #include "modules/navigation/nav_utils.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
@@ -62,6 +64,67 @@ static inline Array build_array(Variant item, Targs... Fargs) {
 	return a;
 }
 
+// Grid of 1x1 quads from `p_from_x` to `p_to_x`, with a wall of missing quads at `p_wall_x` that is only open at `p_gap_z`.
+static inline Ref<NavigationMesh> build_grid_navigation_mesh(int p_from_x, int p_to_x, int p_size, int p_wall_x, int p_gap_z = -1) {
+	Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+	const int row_size = p_to_x - p_from_x + 1;
+
+	Vector<Vector3> vertices;
+	for (int z = 0; z <= p_size; z++) {
+		for (int x = p_from_x; x <= p_to_x; x++) {
+			vertices.push_back(Vector3(x, 0, z));
+		}
+	}
+	navigation_mesh->set_vertices(vertices);
+
+	// The wall has a two cells wide gap, at the far end by default.
+	const int gap_z = p_gap_z < 0 ? p_size - 2 : p_gap_z;
+	for (int z = 0; z < p_size; z++) {
+		for (int x = p_from_x; x < p_to_x; x++) {
+			if (x == p_wall_x && (z < gap_z || z >= gap_z + 2)) {
+				continue;
+			}
+			const int index = z * row_size + (x - p_from_x);
+			Vector<int> polygon;
+			polygon.push_back(index);
+			polygon.push_back(index + 1);
+			polygon.push_back(index + row_size + 1);
+			polygon.push_back(index + row_size);
+			navigation_mesh->add_polygon(polygon);
+		}
+	}
+	return navigation_mesh;
+}
+
+static inline real_t get_path_length(const Vector<Vector3> &p_path) {
+	real_t length = 0.0;
+	for (int i = 1; i < p_path.size(); i++) {
+		length += p_path[i - 1].distance_to(p_path[i]);
+	}
+	return length;
+}
+
+// Whether a polygon of the navigation mesh covers the point, seen from above.
+static inline bool navigation_mesh_covers_point(const Ref<NavigationMesh> &p_navigation_mesh, const Vector3 &p_point) {
+	const Vector<Vector3> vertices = p_navigation_mesh->get_vertices();
+	for (int i = 0; i < p_navigation_mesh->get_polygon_count(); i++) {
+		const Vector<int> polygon = p_navigation_mesh->get_polygon(i);
+		bool has_left = false;
+		bool has_right = false;
+		for (int j = 0; j < polygon.size(); j++) {
+			const Vector3 &from = vertices[polygon[j]];
+			const Vector3 &to = vertices[polygon[(j + 1) % polygon.size()]];
+			const real_t side = (to.x - from.x) * (p_point.z - from.z) - (to.z - from.z) * (p_point.x - from.x);
+			has_left = has_left || side > CMP_EPSILON;
+			has_right = has_right || side < -CMP_EPSILON;
+		}
+		if (!has_left || !has_right) {
+			return true;
+		}
+	}
+	return false;
+}
+
 struct GreaterThan {
 	bool operator()(int p_a, int p_b) const { return p_a > p_b; }
 };
@@ -651,6 +714,46 @@ TEST_SUITE("[Navigation]") {
 		memdelete(node_3d);
 	}
 
+	TEST_CASE("[NavigationServer3D][SceneTree] Parsing many nodes on threads should match parsing them one by one") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		Node3D *node_3d = memnew(Node3D);
+		node_3d->set_position(Vector3(1.0, 2.0, 3.0));
+		SceneTree::get_singleton()->get_root()->add_child(node_3d);
+
+		Ref<PlaneMesh> plane_mesh = memnew(PlaneMesh);
+		Ref<BoxMesh> box_mesh = memnew(BoxMesh);
+		Ref<SphereMesh> sphere_mesh = memnew(SphereMesh);
+		const Ref<Mesh> meshes[3] = { plane_mesh, box_mesh, sphere_mesh };
+		LocalVector<MeshInstance3D *> mesh_instances;
+		for (int i = 0; i < 12; i++) {
+			MeshInstance3D *mesh_instance = memnew(MeshInstance3D);
+			mesh_instance->set_mesh(meshes[i % 3]);
+			mesh_instance->set_transform(Transform3D(Basis(Vector3(0.0, 1.0, 0.0), i * 0.5).scaled(Vector3(1.0 + i, 1.0, 1.0)), Vector3(i * 2.0, 0.0, -i)));
+			node_3d->add_child(mesh_instance);
+			mesh_instances.push_back(mesh_instance);
+		}
+
+		// With the default thread settings, more than one item is parsed on worker threads.
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+		navigation_server->parse_source_geometry_data(navigation_mesh, source_geometry, node_3d);
+
+		Ref<NavigationMeshSourceGeometryData3D> serial_source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+		serial_source_geometry->root_node_transform = node_3d->get_global_transform().affine_inverse();
+		for (MeshInstance3D *mesh_instance : mesh_instances) {
+			serial_source_geometry->add_mesh(mesh_instance->get_mesh(), mesh_instance->get_global_transform());
+		}
+
+		REQUIRE_GT(serial_source_geometry->get_indices().size(), 0);
+		CHECK_EQ(source_geometry->get_vertices().size(), serial_source_geometry->get_vertices().size());
+		CHECK_EQ(source_geometry->get_indices().size(), serial_source_geometry->get_indices().size());
+		CHECK(source_geometry->get_vertices() == serial_source_geometry->get_vertices());
+		CHECK(source_geometry->get_indices() == serial_source_geometry->get_indices());
+
+		memdelete(node_3d);
+	}
+
 	// This test case uses only public APIs on purpose - other test cases use simplified baking.
 	TEST_CASE("[NavigationServer3D][SceneTree] Server should be able to bake map correctly") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -701,6 +804,107 @@ TEST_SUITE("[Navigation]") {
 		memdelete(node_3d);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should rebake only the dirty tiles of a navigation mesh") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(20.0, 0.001, 20.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+
+		// 4x4 tiles.
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(5.0);
+		navigation_mesh->set_filter_baking_aabb(AABB(Vector3(-10.0, -1.0, -10.0), Vector3(20.0, 2.0, 20.0)));
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_GT(navigation_mesh->get_polygon_count(), 0);
+		CHECK(navigation_mesh_covers_point(navigation_mesh, Vector3(7.0, 0.0, 7.0)));
+		CHECK(navigation_mesh_covers_point(navigation_mesh, Vector3(-7.0, 0.0, -7.0)));
+
+		// One obstruction inside the dirty AABB, in the last tile, and one outside of it, in the first tile.
+		Vector<Vector3> obstruction_vertices;
+		obstruction_vertices.push_back(Vector3(6.0, 0.0, 6.0));
+		obstruction_vertices.push_back(Vector3(8.0, 0.0, 6.0));
+		obstruction_vertices.push_back(Vector3(8.0, 0.0, 8.0));
+		obstruction_vertices.push_back(Vector3(6.0, 0.0, 8.0));
+		source_geometry->add_projected_obstruction(obstruction_vertices, -0.5, 1.0, true);
+		Vector<Vector3> untouched_obstruction_vertices;
+		untouched_obstruction_vertices.push_back(Vector3(-8.0, 0.0, -8.0));
+		untouched_obstruction_vertices.push_back(Vector3(-6.0, 0.0, -8.0));
+		untouched_obstruction_vertices.push_back(Vector3(-6.0, 0.0, -6.0));
+		untouched_obstruction_vertices.push_back(Vector3(-8.0, 0.0, -6.0));
+		source_geometry->add_projected_obstruction(untouched_obstruction_vertices, -0.5, 1.0, true);
+
+		navigation_server->rebake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(6.0, -0.5, 6.0), Vector3(2.0, 1.0, 2.0)), Callable());
+		CHECK_GT(navigation_mesh->get_polygon_count(), 0);
+		CHECK_FALSE(navigation_mesh_covers_point(navigation_mesh, Vector3(7.0, 0.0, 7.0)));
+		// The first tile was kept from the previous bake, so it does not know about the second obstruction yet.
+		CHECK(navigation_mesh_covers_point(navigation_mesh, Vector3(-7.0, 0.0, -7.0)));
+
+		navigation_server->rebake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(-8.0, -0.5, -8.0), Vector3(2.0, 1.0, 2.0)), Callable());
+		CHECK_FALSE(navigation_mesh_covers_point(navigation_mesh, Vector3(7.0, 0.0, 7.0)));
+		CHECK_FALSE(navigation_mesh_covers_point(navigation_mesh, Vector3(-7.0, 0.0, -7.0)));
+
+		// Once all dirty areas were rebaked, the tiles should match what a full bake gives.
+		Ref<NavigationMesh> full_navigation_mesh = memnew(NavigationMesh);
+		full_navigation_mesh->set_tile_size(5.0);
+		full_navigation_mesh->set_filter_baking_aabb(AABB(Vector3(-10.0, -1.0, -10.0), Vector3(20.0, 2.0, 20.0)));
+		navigation_server->bake_from_source_geometry_data(full_navigation_mesh, source_geometry, Callable());
+		CHECK_EQ(navigation_mesh->get_polygon_count(), full_navigation_mesh->get_polygon_count());
+		CHECK(navigation_mesh->get_vertices() == full_navigation_mesh->get_vertices());
+	}
+
+	TEST_CASE("[NavigationServer3D] Paths should cross the seams of tiled navigation meshes") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		// A slope, so the tile seams along it have different heights.
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(20.0, 0.001, 20.0));
+		source_geometry->add_mesh_array(arr, Transform3D(Basis(Vector3(0.0, 0.0, 1.0), Math::deg_to_rad(10.0)), Vector3()));
+
+		// A wall on the middle seam that is only open at the far end, so the path has to cross several seams.
+		Vector<Vector3> obstruction_vertices;
+		obstruction_vertices.push_back(Vector3(-1.0, 0.0, -11.0));
+		obstruction_vertices.push_back(Vector3(1.0, 0.0, -11.0));
+		obstruction_vertices.push_back(Vector3(1.0, 0.0, 5.0));
+		obstruction_vertices.push_back(Vector3(-1.0, 0.0, 5.0));
+		source_geometry->add_projected_obstruction(obstruction_vertices, -5.0, 10.0, false);
+
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(5.0);
+		navigation_mesh->set_filter_baking_aabb(AABB(Vector3(-10.0, -5.0, -10.0), Vector3(20.0, 10.0, 20.0)));
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		REQUIRE_GT(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		RID region = navigation_server->region_create();
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		const real_t slope = Math::tan(Math::deg_to_rad(10.0));
+		const Vector3 start_position = navigation_server->map_get_closest_point(map, Vector3(-8.0, -8.0 * slope, -8.0));
+		const Vector3 target_position = navigation_server->map_get_closest_point(map, Vector3(8.0, 8.0 * slope, -8.0));
+		CHECK_LT(start_position.distance_to(Vector3(-8.0, start_position.y, -8.0)), 0.5);
+		CHECK_LT(target_position.distance_to(Vector3(8.0, target_position.y, -8.0)), 0.5);
+
+		const Vector<Vector3> path = navigation_server->map_get_path(map, start_position, target_position, true);
+		REQUIRE_GE(path.size(), 3);
+		CHECK(path[0].is_equal_approx(start_position));
+		CHECK_LT(path[path.size() - 1].distance_to(target_position), 0.01);
+		// Going around the wall is about twice as long as the straight line.
+		CHECK_GT(get_path_length(path), 30.0);
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
 	// This test case does not check precise values on purpose - to not be too sensitivte.
 	TEST_CASE("[NavigationServer3D] Server should respond to queries against valid map properly") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
@@ -798,6 +1002,246 @@ TEST_SUITE("[Navigation]") {
 		navigation_server->process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Hierarchical pathfinding should match the regular search") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		const int size = 40;
+		const int wall_x = 20;
+		Ref<NavigationMesh> left_navigation_mesh = build_grid_navigation_mesh(0, wall_x + 1, size, wall_x);
+		Ref<NavigationMesh> right_navigation_mesh = build_grid_navigation_mesh(wall_x + 1, size, size, wall_x);
+
+		RID maps[2];
+		RID left_regions[2];
+		RID right_regions[2];
+		for (int i = 0; i < 2; i++) {
+			maps[i] = navigation_server->map_create();
+			navigation_server->map_set_active(maps[i], true);
+			navigation_server->map_set_use_async_iterations(maps[i], false);
+			navigation_server->map_set_use_hierarchical_pathfinding(maps[i], i == 1);
+			navigation_server->map_set_hierarchy_cluster_size(maps[i], 8.0);
+
+			left_regions[i] = navigation_server->region_create();
+			navigation_server->region_set_map(left_regions[i], maps[i]);
+			navigation_server->region_set_navigation_mesh(left_regions[i], left_navigation_mesh);
+
+			right_regions[i] = navigation_server->region_create();
+			navigation_server->region_set_map(right_regions[i], maps[i]);
+			navigation_server->region_set_navigation_mesh(right_regions[i], right_navigation_mesh);
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		CHECK_FALSE(navigation_server->map_get_use_hierarchical_pathfinding(maps[0]));
+		CHECK(navigation_server->map_get_use_hierarchical_pathfinding(maps[1]));
+		CHECK_EQ(navigation_server->map_get_hierarchy_cluster_size(maps[1]), doctest::Approx(8.0));
+
+		const Vector3 start_position = Vector3(2.5, 0, 2.5);
+		const Vector3 target_position = Vector3(37.5, 0, 2.5);
+
+		SUBCASE("Paths around the wall should be as long as with the regular search") {
+			const Vector<Vector3> path = navigation_server->map_get_path(maps[0], start_position, target_position, true);
+			const Vector<Vector3> hierarchical_path = navigation_server->map_get_path(maps[1], start_position, target_position, true);
+			REQUIRE_GE(path.size(), 3);
+			REQUIRE_GE(hierarchical_path.size(), 3);
+			CHECK(hierarchical_path[0].is_equal_approx(path[0]));
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(path[path.size() - 1]));
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(target_position));
+			CHECK_GT(get_path_length(hierarchical_path), 70.0);
+			CHECK_LE(get_path_length(hierarchical_path), get_path_length(path) * 1.05);
+		}
+
+		SUBCASE("Paths should follow region changes") {
+			for (int i = 0; i < 2; i++) {
+				navigation_server->region_set_enabled(right_regions[i], false);
+			}
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			// The target is unreachable, both searches stop on the left side of the wall.
+			Vector<Vector3> path = navigation_server->map_get_path(maps[0], start_position, target_position, true);
+			Vector<Vector3> hierarchical_path = navigation_server->map_get_path(maps[1], start_position, target_position, true);
+			REQUIRE_GE(hierarchical_path.size(), 2);
+			CHECK_LE(hierarchical_path[hierarchical_path.size() - 1].x, wall_x + 1);
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(path[path.size() - 1]));
+
+			for (int i = 0; i < 2; i++) {
+				navigation_server->region_set_enabled(right_regions[i], true);
+			}
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			path = navigation_server->map_get_path(maps[0], start_position, target_position, true);
+			hierarchical_path = navigation_server->map_get_path(maps[1], start_position, target_position, true);
+			REQUIRE_GE(hierarchical_path.size(), 3);
+			CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(target_position));
+			CHECK_LE(get_path_length(hierarchical_path), get_path_length(path) * 1.05);
+		}
+
+		for (int i = 0; i < 2; i++) {
+			navigation_server->free(left_regions[i]);
+			navigation_server->free(right_regions[i]);
+			navigation_server->free(maps[i]);
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Batched path queries should match single queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		const int size = 40;
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, build_grid_navigation_mesh(0, size, size, size / 2));
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		const int query_count = 256;
+		PackedVector3Array start_target_positions;
+		PackedInt32Array navigation_layers;
+		PackedInt32Array path_postprocessing;
+		for (int i = 0; i < query_count; i++) {
+			start_target_positions.push_back(Vector3((i * 7) % size + 0.5, 0, (i * 13) % size + 0.5));
+			start_target_positions.push_back(Vector3((i * 11) % size + 0.5, 0, (i * 3) % size + 0.5));
+			// Every fourth query uses layers that no region has, it gets no path.
+			navigation_layers.push_back(i % 4 == 3 ? 2 : 1);
+			path_postprocessing.push_back(i % 2 == 0 ? NavigationPathQueryParameters3D::PATH_POSTPROCESSING_CORRIDORFUNNEL : NavigationPathQueryParameters3D::PATH_POSTPROCESSING_EDGECENTERED);
+		}
+
+		PackedVector3Array path_points;
+		PackedInt32Array path_point_counts;
+		navigation_server->map_query_path_batch(map, start_target_positions, navigation_layers, path_postprocessing, path_points, path_point_counts);
+		REQUIRE_EQ(path_point_counts.size(), query_count);
+
+		int path_offset = 0;
+		for (int i = 0; i < query_count; i++) {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, start_target_positions[i * 2], start_target_positions[i * 2 + 1], i % 2 == 0, navigation_layers[i]);
+			REQUIRE_EQ(path_point_counts[i], path.size());
+			for (int j = 0; j < path.size(); j++) {
+				CHECK_EQ(path_points[path_offset + j], path[j]);
+			}
+			path_offset += path_point_counts[i];
+		}
+		CHECK_EQ(path_offset, path_points.size());
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE_BENCHMARK("[Benchmark][NavigationServer3D] Batched path queries against single queries") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		const int size = 40;
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, build_grid_navigation_mesh(0, size, size, size / 2));
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		const int query_count = 10000;
+		PackedVector3Array start_target_positions;
+		PackedInt32Array navigation_layers;
+		PackedInt32Array path_postprocessing;
+		for (int i = 0; i < query_count; i++) {
+			start_target_positions.push_back(Vector3((i * 7) % size + 0.5, 0, (i * 13) % size + 0.5));
+			start_target_positions.push_back(Vector3((i * 11) % size + 0.5, 0, (i * 3) % size + 0.5));
+			navigation_layers.push_back(1);
+			path_postprocessing.push_back(NavigationPathQueryParameters3D::PATH_POSTPROCESSING_CORRIDORFUNNEL);
+		}
+
+		uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		int single_point_count = 0;
+		for (int i = 0; i < query_count; i++) {
+			single_point_count += navigation_server->map_get_path(map, start_target_positions[i * 2], start_target_positions[i * 2 + 1], true).size();
+		}
+		const uint64_t single_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+		PackedVector3Array path_points;
+		PackedInt32Array path_point_counts;
+		begin_usec = OS::get_singleton()->get_ticks_usec();
+		navigation_server->map_query_path_batch(map, start_target_positions, navigation_layers, path_postprocessing, path_points, path_point_counts);
+		const uint64_t batch_usec = MAX(OS::get_singleton()->get_ticks_usec() - begin_usec, (uint64_t)1);
+
+		MESSAGE(vformat("Single queries: %d queries/s, %d path points.", (int64_t)(query_count * 1000000.0 / single_usec), single_point_count));
+		MESSAGE(vformat("Batched queries: %d queries/s, %d path points.", (int64_t)(query_count * 1000000.0 / batch_usec), path_points.size()));
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Cached path corridors should give the same paths") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		ProjectSettings *project_settings = ProjectSettings::get_singleton();
+		const Variant old_path_cache_size = project_settings->get_setting("navigation/pathfinding/path_cache_size");
+
+		const int size = 40;
+		const int wall_x = 20;
+		Ref<NavigationMesh> navigation_mesh = build_grid_navigation_mesh(0, size, size, wall_x);
+
+		RID maps[2];
+		RID regions[2];
+		for (int i = 0; i < 2; i++) {
+			// Maps read the setting when they get created.
+			project_settings->set_setting("navigation/pathfinding/path_cache_size", i == 1 ? 16 : 0);
+
+			maps[i] = navigation_server->map_create();
+			navigation_server->map_set_active(maps[i], true);
+			navigation_server->map_set_use_async_iterations(maps[i], false);
+
+			regions[i] = navigation_server->region_create();
+			navigation_server->region_set_map(regions[i], maps[i]);
+			navigation_server->region_set_navigation_mesh(regions[i], navigation_mesh);
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+
+		project_settings->set_setting("navigation/pathfinding/path_cache_size", old_path_cache_size);
+
+		const Vector3 start_position = Vector3(2.5, 0, 2.5);
+		const Vector3 target_position = Vector3(37.5, 0, 2.5);
+
+		SUBCASE("Repeated queries should return the uncached path") {
+			const Vector<Vector3> path = navigation_server->map_get_path(maps[0], start_position, target_position, true);
+			REQUIRE_GE(path.size(), 3);
+			for (int i = 0; i < 3; i++) {
+				const Vector<Vector3> cached_path = navigation_server->map_get_path(maps[1], start_position, target_position, true);
+				REQUIRE_EQ(cached_path.size(), path.size());
+				for (int j = 0; j < path.size(); j++) {
+					CHECK(cached_path[j].is_equal_approx(path[j]));
+				}
+			}
+		}
+
+		SUBCASE("Map changes should drop cached corridors") {
+			const Vector<Vector3> old_path = navigation_server->map_get_path(maps[1], start_position, target_position, true);
+			REQUIRE_GE(old_path.size(), 3);
+
+			// Moving the gap in the wall close to the start and target keeps the same polygons, so the
+			// begin and end polygons of the queries keep their IDs. Only the corridor between them changes.
+			Ref<NavigationMesh> moved_gap_navigation_mesh = build_grid_navigation_mesh(0, size, size, wall_x, 8);
+			for (int i = 0; i < 2; i++) {
+				navigation_server->region_set_navigation_mesh(regions[i], moved_gap_navigation_mesh);
+			}
+			navigation_server->process(0.0); // Give server some cycles to commit.
+
+			const Vector<Vector3> path = navigation_server->map_get_path(maps[0], start_position, target_position, true);
+			const Vector<Vector3> cached_path = navigation_server->map_get_path(maps[1], start_position, target_position, true);
+			REQUIRE_GE(path.size(), 3);
+			REQUIRE_EQ(cached_path.size(), path.size());
+			for (int i = 0; i < path.size(); i++) {
+				CHECK(cached_path[i].is_equal_approx(path[i]));
+			}
+			CHECK(get_path_length(cached_path) < get_path_length(old_path) - 40.0);
+		}
+
+		for (int i = 0; i < 2; i++) {
+			navigation_server->free(regions[i]);
+			navigation_server->free(maps[i]);
+		}
+		navigation_server->process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
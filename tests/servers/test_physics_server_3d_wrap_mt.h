@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  test_physics_server_3d_wrap_mt.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PHYSICS_SERVER_3D_WRAP_MT_H
+#define TEST_PHYSICS_SERVER_3D_WRAP_MT_H
+
+#include "servers/physics_server_3d_dummy.h"
+#include "servers/physics_server_3d_wrap_mt.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPhysicsServer3DWrapMT {
+
+// Reports the step count as the transform of every body, and counts reads of freed bodies.
+class PipelinedTestServer : public PhysicsServer3DDummy {
+public:
+	uint64_t last_rid = 0;
+	int steps = 0;
+	RID free_on_step;
+	HashSet<RID> freed;
+	mutable int freed_reads = 0;
+
+	virtual RID body_create() override { return RID::from_uint64(++last_rid); }
+	virtual RID soft_body_create() override { return RID::from_uint64(++last_rid); }
+
+	virtual Variant body_get_state(RID p_body, BodyState p_state) const override {
+		if (freed.has(p_body)) {
+			freed_reads++;
+		}
+		return p_state == BODY_STATE_TRANSFORM ? Variant(Transform3D(Basis(), Vector3(p_body.get_id(), steps, 0))) : Variant();
+	}
+
+	virtual AABB soft_body_get_bounds(RID p_body) const override {
+		if (freed.has(p_body)) {
+			freed_reads++;
+		}
+		return AABB(Vector3(p_body.get_id(), steps, 0), Vector3(1, 1, 1));
+	}
+
+	virtual void step(real_t p_step) override {
+		steps++;
+		if (free_on_step.is_valid()) {
+			// Like a callback freeing a body on the server thread.
+			PhysicsServer3D::get_singleton()->free(free_on_step);
+			free_on_step = RID();
+		}
+	}
+
+	virtual void free(RID p_rid) override {
+		freed.insert(p_rid);
+	}
+};
+
+TEST_CASE("[PhysicsServer3D] Pipelined body state reads") {
+	// Not a [SceneTree] test, so there is no other physics server and this one is the singleton.
+	PipelinedTestServer *server = memnew(PipelinedTestServer);
+	PhysicsServer3DWrapMT *wrap = memnew(PhysicsServer3DWrapMT(server, true, true));
+	wrap->init();
+
+	const RID body = wrap->body_create();
+	const RID other_body = wrap->body_create();
+	const RID soft_body = wrap->soft_body_create();
+
+	// Nothing is running yet, so reading waits for the server and starts tracking the bodies.
+	Transform3D xform = wrap->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK(xform.origin == Vector3(body.get_id(), 0, 0));
+	wrap->body_get_state(other_body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	wrap->soft_body_get_bounds(soft_body);
+
+	// While a step runs, reads return the state at the end of the previous one.
+	wrap->step(1.0 / 60.0);
+	wrap->sync();
+	wrap->step(1.0 / 60.0);
+	xform = wrap->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	CHECK(xform.origin == Vector3(body.get_id(), 1, 0));
+	CHECK(wrap->soft_body_get_bounds(soft_body).position == Vector3(soft_body.get_id(), 1, 0));
+	wrap->sync();
+
+	SUBCASE("Freed on the server thread") {
+		server->free_on_step = body;
+		wrap->step(1.0 / 60.0);
+		wrap->sync();
+		CHECK(server->freed.has(body));
+
+		wrap->step(1.0 / 60.0);
+		xform = wrap->body_get_state(other_body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		CHECK(xform.origin == Vector3(other_body.get_id(), 3, 0));
+		wrap->sync();
+	}
+
+	SUBCASE("Freed on the main thread") {
+		wrap->free(body);
+		wrap->free(soft_body);
+		wrap->step(1.0 / 60.0);
+		wrap->sync();
+		CHECK(server->freed.has(body));
+		CHECK(server->freed.has(soft_body));
+
+		wrap->step(1.0 / 60.0);
+		xform = wrap->body_get_state(other_body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		CHECK(xform.origin == Vector3(other_body.get_id(), 3, 0));
+		wrap->sync();
+	}
+
+	// Freed bodies are no longer snapshotted after the steps.
+	CHECK(server->freed_reads == 0);
+
+	wrap->finish();
+	memdelete(wrap);
+}
+
+} // namespace TestPhysicsServer3DWrapMT
+
+#endif // TEST_PHYSICS_SERVER_3D_WRAP_MT_H